@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file AdaptiveFilterTable.cpp
+ * @brief Implementation of the AdaptiveFilterTable class.
+ */
+
+#include "AdaptiveFilterTable.h"
+#include "IIRFilter.h"
+
+AdaptiveFilterTable::AdaptiveFilterTable(float cutoffHz, uint32_t nominalPeriodMicros)
+    : mSpanMicros(2 * nominalPeriodMicros), mIndexScale(0) {
+    if (mSpanMicros == 0) {
+        mSpanMicros = 1;
+    }
+    mIndexScale = ((uint32_t)BINS << 24) / mSpanMicros;
+
+    for (uint8_t i = 0; i < BINS; i++) {
+        float sampleTime = (float)mSpanMicros * 1.0e-6f * (float)(i + 1) / (float)BINS;
+        IIRFilter design = IIRFilter::butterworth1(cutoffHz, sampleTime);
+        mTable[i].b = design.b0();
+        mTable[i].a1 = design.a1();
+    }
+}
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file AdaptiveFilterTable.h
+ * @brief Precomputed first-order filter coefficients indexed by the measured sample time.
+ *
+ * A fixed IIR filter assumes a constant sample period; when the loop overruns,
+ * its effective cutoff drifts. AdaptiveFilterTable stores first-order Butterworth
+ * coefficients for a range of quantized sample times, designed once at
+ * construction, so the estimator can pick the coefficients matching the measured
+ * deltaTime on every call with a multiply and a shift (no tan()/exp() on the hot path).
+ *
+ * The table has AdaptiveFilterTable::BINS entries, designed for one to BINS bin
+ * widths of nominal / 8 (up to 2x the nominal period). Sample times are rounded to
+ * the nearest bin; shorter ones use the first entry and longer ones the last.
+ *
+ * The coefficients are first-order only.
+ */
+
+#ifndef __ADAPTIVEFILTERTABLE_H__
+#define __ADAPTIVEFILTERTABLE_H__
+
+#include <Arduino.h>
+
+// The bin count is part of the class layout, so it cannot be a per-sketch setting
+#ifdef SPEEDESTIMATOR_ADAPTIVE_BINS
+#error "SPEEDESTIMATOR_ADAPTIVE_BINS is no longer supported: the table has AdaptiveFilterTable::BINS entries"
+#endif
+
+/**
+ * @class AdaptiveFilterTable
+ * @brief Sample-time-indexed table of first-order low-pass coefficients.
+ *
+ * One table can be shared by several estimators with the same cutoff.
+ *
+ * Example usage:
+ * @code
+ * AdaptiveFilterTable adaptiveTable(5.0f, 10000); // 5 Hz cutoff, 10 ms nominal period
+ * speedEstimator.setAdaptiveFilter(&adaptiveTable);
+ * @endcode
+ */
+class AdaptiveFilterTable {
+    public:
+        /**
+         * @brief First-order coefficients: y = b * (x + x[n-1]) - a1 * y[n-1].
+         */
+        struct Coefficients {
+            float b;
+            float a1;
+        };
+
+        static const uint8_t BINS = 16; ///< Table entries, one per nominal / 8.
+
+    private:
+        Coefficients mTable[BINS]; ///< Entry i is designed for dt = (i + 1) * bin width.
+        uint32_t mSpanMicros; ///< Sample time covered by the table (2x nominal).
+        uint32_t mIndexScale; ///< Bins per microsecond in Q24, replaces a division by the bin width.
+
+    public:
+        /**
+         * @brief Build the table.
+         * @param cutoffHz Cutoff (-3 dB) frequency in Hz, kept for every sample time.
+         * @param nominalPeriodMicros Nominal sample period in microseconds.
+         */
+        AdaptiveFilterTable(float cutoffHz, uint32_t nominalPeriodMicros);
+
+        /**
+         * @brief Coefficients for the measured sample time.
+         * @param deltaTimeMicros Measured sample time in microseconds.
+         */
+        const Coefficients& lookup(uint32_t deltaTimeMicros) const {
+            if (deltaTimeMicros >= mSpanMicros) {
+                return mTable[BINS - 1];
+            }
+            // Round to the nearest bin: bins = dt / binWidth + 0.5. Below half a bin, the
+            // first entry (a design for dt = 0 would freeze the filter)
+            uint32_t bins = (deltaTimeMicros * mIndexScale + 0x800000UL) >> 24;
+            return mTable[(bins > 0) ? bins - 1 : 0];
+        }
+};
+
+#endif
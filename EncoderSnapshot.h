@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file EncoderSnapshot.h
+ * @brief Lock-free (seqlock) snapshot of the encoder count and its timestamp.
+ *
+ * The encoder ISR (single writer) publishes the pulse count together with the
+ * timestamp of the edge that produced it. The control loop reads both values
+ * consistently without disabling interrupts: the writer makes a sequence counter
+ * odd while it updates the data and even again when done, and the reader retries
+ * if the counter was odd or changed during its read.
+ *
+ * Compared to reading the count inside ATOMIC_BLOCK / noInterrupts(), no other
+ * interrupt (PWM, communications, ...) is delayed by the reader.
+ */
+
+#ifndef __ENCODERSNAPSHOT_H__
+#define __ENCODERSNAPSHOT_H__
+
+#include <stdint.h>
+
+#if defined(__AVR__)
+// Single-byte accesses are atomic on AVR, and there is a single core
+typedef uint8_t EncoderSnapshotSequence;
+#define ENCODERSNAPSHOT_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+typedef uint32_t EncoderSnapshotSequence;
+#define ENCODERSNAPSHOT_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/**
+ * @class EncoderSnapshot
+ * @brief Count and edge timestamp shared between the encoder ISR and the control loop.
+ *
+ * Example usage:
+ * @code
+ * EncoderSnapshot encoder;
+ *
+ * void readEncoderPulses() { encoder.increment(1, micros()); } // ISR
+ *
+ * void loop() {
+ *     float speed = speedEstimator.estimateSpeed(encoder);
+ * }
+ * @endcode
+ */
+class EncoderSnapshot {
+    private:
+        volatile EncoderSnapshotSequence mSequence; ///< Odd while the writer is updating the data.
+        volatile int32_t mCount; ///< Pulse count.
+        volatile uint32_t mTimestamp; ///< Timestamp of the edge that produced mCount.
+
+    public:
+        EncoderSnapshot() : mSequence(0), mCount(0), mTimestamp(0) {}
+
+        /**
+         * @brief Publish a new count and timestamp (writer side, e.g. the encoder ISR).
+         * @note There must be a single writer; it must not be interrupted by another writer.
+         */
+        void write(int32_t count, uint32_t timestamp) {
+            EncoderSnapshotSequence sequence = mSequence;
+            mSequence = sequence + 1;
+            ENCODERSNAPSHOT_BARRIER();
+            mCount = count;
+            mTimestamp = timestamp;
+            ENCODERSNAPSHOT_BARRIER();
+            mSequence = sequence + 2;
+        }
+
+        /**
+         * @brief Add step pulses to the count and publish it with its timestamp (writer side).
+         */
+        void increment(int32_t step, uint32_t timestamp) { write(mCount + step, timestamp); }
+
+        /**
+         * @brief Read a consistent count and timestamp pair (reader side, e.g. the control loop).
+         * @return Number of retries needed (0 if the writer did not interfere).
+         */
+        uint8_t read(int32_t& count, uint32_t& timestamp) const {
+            uint8_t retries = 0;
+            for (;;) {
+                EncoderSnapshotSequence begin = mSequence;
+                ENCODERSNAPSHOT_BARRIER();
+                count = mCount;
+                timestamp = mTimestamp;
+                ENCODERSNAPSHOT_BARRIER();
+                if ((begin & 1) == 0 && mSequence == begin) {
+                    return retries;
+                }
+                if (retries < 255) {
+                    retries++;
+                }
+            }
+        }
+};
+
+#endif
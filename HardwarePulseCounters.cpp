@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file HardwarePulseCounters.cpp
+ * @brief Implementation of the hardware pulse counter HALs.
+ */
+
+#include "HardwarePulseCounters.h"
+
+#if defined(ESP32)
+#include <soc/pcnt_struct.h>
+#endif
+
+#if defined(__AVR__) && defined(TCNT1)
+void AvrTimer1CounterHal::configure() {
+    uint8_t oldSREG = SREG;
+    cli();
+    TCCR1B = 0; // Stop the timer while configuring it
+    TCCR1A = 0; // Normal mode, no output compare
+    TCNT1 = 0;
+    TIFR1 = _BV(TOV1); // Clear a stale overflow flag
+    TIMSK1 = _BV(TOIE1); // Overflow interrupt only
+    TCCR1B = _BV(CS12) | _BV(CS11) | _BV(CS10); // External clock on T1, rising edge
+    SREG = oldSREG;
+}
+#endif
+
+#if defined(ESP32)
+void IRAM_ATTR Esp32PcntCounterHal::onLimitEvent(void* arg) {
+    Esp32PcntCounterHal* hal = (Esp32PcntCounterHal*)arg;
+    uint32_t status = 0;
+    pcnt_get_event_status(hal->mUnit, &status);
+    if (hal->mOwner != nullptr) {
+        if (status & PCNT_EVT_H_LIM) {
+            hal->mOwner->onWrap(1);
+        } else if (status & PCNT_EVT_L_LIM) {
+            hal->mOwner->onWrap(-1);
+        }
+    }
+}
+
+void Esp32PcntCounterHal::configure() {
+    pcnt_config_t config = {};
+    config.pulse_gpio_num = mPulsePin;
+    config.ctrl_gpio_num = mDirectionPin;
+    config.channel = PCNT_CHANNEL_0;
+    config.unit = mUnit;
+    config.pos_mode = PCNT_COUNT_INC; // Count rising edges
+    config.neg_mode = PCNT_COUNT_DIS;
+    config.lctrl_mode = PCNT_MODE_REVERSE; // Count down while the direction pin is low
+    config.hctrl_mode = PCNT_MODE_KEEP;
+    config.counter_h_lim = (int16_t)WRAP_SPAN;
+    config.counter_l_lim = (int16_t)-WRAP_SPAN;
+    pcnt_unit_config(&config);
+
+    pcnt_counter_pause(mUnit);
+    pcnt_counter_clear(mUnit);
+    pcnt_event_enable(mUnit, PCNT_EVT_H_LIM);
+    pcnt_event_enable(mUnit, PCNT_EVT_L_LIM);
+
+    // The service may already be installed by another unit
+    pcnt_isr_service_install(0);
+    pcnt_isr_handler_add(mUnit, onLimitEvent, this);
+    pcnt_intr_enable(mUnit);
+    pcnt_counter_resume(mUnit);
+}
+
+int32_t Esp32PcntCounterHal::readRaw() {
+    int16_t value = 0;
+    pcnt_get_counter_value(mUnit, &value);
+    return value;
+}
+
+int8_t Esp32PcntCounterHal::pendingWrap() {
+    // Raw interrupt flag still set: the ISR has not cleared it yet
+    if ((PCNT.int_raw.val & BIT(mUnit)) == 0) {
+        return 0;
+    }
+    uint32_t status = 0;
+    pcnt_get_event_status(mUnit, &status);
+    if (status & PCNT_EVT_H_LIM) {
+        return 1;
+    }
+    return (status & PCNT_EVT_L_LIM) ? -1 : 0;
+}
+#endif
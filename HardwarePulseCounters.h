@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file HardwarePulseCounters.h
+ * @brief Counter16Hal implementations for hardware pulse counter peripherals.
+ *
+ * - AvrTimer1CounterHal: AVR Timer1 clocked externally from the T1 pin (D5 on
+ *   Uno/Nano, D47 on Mega). Wraps every 65536 pulses with the TOV1 interrupt.
+ * - Esp32PcntCounterHal: ESP32 PCNT unit counting up/down between symmetric limits;
+ *   the counter restarts from 0 at each limit event.
+ *
+ * Both are used through ExtendedPulseCounter (see PulseCounter.h), which extends
+ * the 16-bit hardware count to 32 bits.
+ */
+
+#ifndef __HARDWAREPULSECOUNTERS_H__
+#define __HARDWAREPULSECOUNTERS_H__
+
+#include <Arduino.h>
+#include "PulseCounter.h"
+
+#if defined(ESP32)
+#include <driver/pcnt.h>
+#endif
+
+#if defined(__AVR__) && defined(TCNT1)
+/**
+ * @class AvrTimer1CounterHal
+ * @brief Timer1 counting rising edges on the T1 pin.
+ *
+ * Timer1 is taken over entirely (PWM on pins 9/10 and libraries using Timer1 are
+ * not available). The overflow ISR must be defined by the sketch:
+ * @code
+ * AvrTimer1CounterHal timer1Hal;
+ * ExtendedPulseCounter counter(timer1Hal, AvrTimer1CounterHal::WRAP_SPAN);
+ *
+ * ISR(TIMER1_OVF_vect) { counter.onWrap(1); }
+ *
+ * void setup() { counter.begin(); }
+ * void loop() { float speed = speedEstimator.estimateSpeed(counter); }
+ * @endcode
+ * @note TCNT1 is read through the Timer1 TEMP register: no other ISR may access
+ * 16-bit Timer1 registers.
+ */
+class AvrTimer1CounterHal : public Counter16Hal {
+    public:
+        static const int32_t WRAP_SPAN = 65536L; ///< Counts per overflow.
+
+        void configure();
+        int32_t readRaw() { return (int32_t)TCNT1; }
+        int8_t pendingWrap() { return (TIFR1 & _BV(TOV1)) ? 1 : 0; }
+};
+#endif
+
+#if defined(ESP32)
+/**
+ * @class Esp32PcntCounterHal
+ * @brief ESP32 PCNT unit counting rising edges of a pulse pin, with optional direction pin.
+ *
+ * The limit-event ISR is installed by configure() and forwards the wraps to the owner:
+ * @code
+ * Esp32PcntCounterHal pcntHal(PCNT_UNIT_0, ENCA, ENCB);
+ * ExtendedPulseCounter counter(pcntHal, Esp32PcntCounterHal::WRAP_SPAN);
+ *
+ * void setup() {
+ *     pcntHal.setOwner(&counter);
+ *     counter.begin();
+ * }
+ * @endcode
+ */
+class Esp32PcntCounterHal : public Counter16Hal {
+    private:
+        pcnt_unit_t mUnit; ///< PCNT unit.
+        int mPulsePin; ///< Pin whose rising edges are counted.
+        int mDirectionPin; ///< Pin reversing the count direction when low, or PCNT_PIN_NOT_USED.
+        ExtendedPulseCounter* mOwner; ///< Counter receiving the wraps.
+
+        static void IRAM_ATTR onLimitEvent(void* arg);
+
+    public:
+        static const int32_t WRAP_SPAN = 32000L; ///< Counts per limit event (|h_lim| = |l_lim|).
+
+        /**
+         * @brief Constructor for Esp32PcntCounterHal.
+         * @param unit PCNT unit.
+         * @param pulsePin Pin whose rising edges are counted.
+         * @param directionPin Direction pin (e.g. encoder channel B), or PCNT_PIN_NOT_USED.
+         */
+        Esp32PcntCounterHal(pcnt_unit_t unit, int pulsePin, int directionPin = PCNT_PIN_NOT_USED)
+            : mUnit(unit), mPulsePin(pulsePin), mDirectionPin(directionPin), mOwner(nullptr) {}
+
+        /**
+         * @brief Set the counter notified by the limit-event ISR. Call it before begin().
+         */
+        void setOwner(ExtendedPulseCounter* owner) { mOwner = owner; }
+
+        void configure();
+        int32_t readRaw();
+        int8_t pendingWrap();
+};
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file IIRFilter.cpp
+ * @brief Implementation of the IIRFilter class.
+ */
+
+#include "IIRFilter.h"
+#include <math.h>
+
+/**
+ * @brief Prewarped bilinear-transform constant K = tan(pi * fc * Ts).
+ */
+static float prewarp(float cutoffHz, float sampleTime) {
+    float normalized = cutoffHz * sampleTime;
+    if (normalized > 0.45f) {
+        normalized = 0.45f;
+    }
+    return tanf((float)M_PI * normalized);
+}
+
+IIRFilter::IIRFilter()
+    : mB0(0.1367f), mB1(0.1367f), mB2(0), mA1(-0.7265f), mA2(0), mX1(0), mX2(0), mY1(0), mY2(0) {}
+
+IIRFilter::IIRFilter(float b0, float b1, float b2, float a1, float a2)
+    : mB0(b0), mB1(b1), mB2(b2), mA1(a1), mA2(a2), mX1(0), mX2(0), mY1(0), mY2(0) {}
+
+IIRFilter IIRFilter::butterworth1(float cutoffHz, float sampleTime) {
+    float k = prewarp(cutoffHz, sampleTime);
+    float a1 = (k - 1.0f) / (k + 1.0f);
+    // b0 = b1 = k / (1 + k), taken from the rounded a1 so that the DC gain stays 1
+    float b = 0.5f * (1.0f + a1);
+    return IIRFilter(b, b, 0, a1, 0);
+}
+
+IIRFilter IIRFilter::butterworth2(float cutoffHz, float sampleTime) {
+    double k = prewarp(cutoffHz, sampleTime);
+    double k2 = k * k;
+    double norm = 1.0 / (1.0 + M_SQRT2 * k + k2);
+    float a1 = (float)(2.0 * (k2 - 1.0) * norm);
+    float a2 = (float)((1.0 - M_SQRT2 * k + k2) * norm);
+    // b = k^2 * norm, taken from the rounded feedback coefficients: at low cutoffs
+    // 1 + a1 + a2 is small, and rounding a1 and a2 alone would change the DC gain
+    float b = (float)(0.25 * (1.0 + (double)a1 + (double)a2));
+    return IIRFilter(b, 2.0f * b, b, a1, a2);
+}
+
+void IIRFilter::setCoefficients(float b0, float b1, float b2, float a1, float a2) {
+    mB0 = b0;
+    mB1 = b1;
+    mB2 = b2;
+    mA1 = a1;
+    mA2 = a2;
+}
+
+void IIRFilter::reset() {
+    mX1 = 0;
+    mX2 = 0;
+    mY1 = 0;
+    mY2 = 0;
+}
+
+void IIRFilter::process(float* data, size_t n) {
+    // Locals cannot alias the data buffer, so the state stays in registers
+    const float b0 = mB0, b1 = mB1, b2 = mB2, a1 = mA1, a2 = mA2;
+    float x1 = mX1, x2 = mX2, y1 = mY1, y2 = mY2;
+
+    if (b2 == 0 && a2 == 0) {
+        for (size_t i = 0; i < n; i++) {
+            float x = data[i];
+            float y = b0 * x + b1 * x1 - a1 * y1;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            data[i] = y;
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            float x = data[i];
+            float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            data[i] = y;
+        }
+    }
+
+    mX1 = x1;
+    mX2 = x2;
+    mY1 = y1;
+    mY2 = y2;
+}
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file IIRFilter.h
+ * @brief Configurable low-pass IIR filter used to smooth the estimated speed.
+ *
+ * The filter is a biquad in direct form I:
+ *
+ *   y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+ *
+ * First-order filters simply use b2 = a2 = 0. Butterworth coefficients are
+ * designed from a cutoff frequency and the nominal sample period with the
+ * bilinear transform (with frequency prewarping), once, at construction.
+ */
+
+#ifndef __IIRFILTER_H__
+#define __IIRFILTER_H__
+
+#include <Arduino.h>
+
+/**
+ * @class IIRFilter
+ * @brief First- or second-order IIR low-pass filter.
+ *
+ * Example usage:
+ * @code
+ * // 1 kHz loop, 20 Hz bandwidth
+ * SpeedEstimator speedEstimator(ppr, gearRatio, IIRFilter::butterworth2(20.0f, 0.001f));
+ * @endcode
+ */
+class IIRFilter {
+    private:
+        float mB0, mB1, mB2; ///< Feedforward coefficients.
+        float mA1, mA2; ///< Feedback coefficients (a0 normalized to 1).
+        float mX1, mX2; ///< Previous inputs.
+        float mY1, mY2; ///< Previous outputs.
+
+    public:
+        /**
+         * @brief Default filter: first-order Butterworth, 5 Hz cutoff at a 10 ms sample time.
+         * @note These are the coefficients historically hardcoded in SpeedEstimator.
+         */
+        IIRFilter();
+
+        /**
+         * @brief Filter from explicit coefficients (a0 normalized to 1).
+         */
+        IIRFilter(float b0, float b1, float b2, float a1, float a2);
+
+        /**
+         * @brief Design a first-order Butterworth low-pass filter.
+         * @param cutoffHz Cutoff (-3 dB) frequency in Hz.
+         * @param sampleTime Nominal sample period in seconds.
+         * @note The cutoff is limited to 0.45 times the sampling frequency.
+         */
+        static IIRFilter butterworth1(float cutoffHz, float sampleTime);
+
+        /**
+         * @brief Design a second-order Butterworth low-pass filter.
+         * @param cutoffHz Cutoff (-3 dB) frequency in Hz.
+         * @param sampleTime Nominal sample period in seconds.
+         * @note The cutoff is limited to 0.45 times the sampling frequency. The DC gain is
+         * 1; with float coefficients the gain at the cutoff is within 0.1 % of -3 dB for
+         * cutoffs down to 1/1000 of the sampling frequency (0.5 % at 1/2000).
+         */
+        static IIRFilter butterworth2(float cutoffHz, float sampleTime);
+
+        /**
+         * @brief Filter one sample.
+         * @param x New input sample.
+         * @return The filtered output.
+         */
+        float update(float x) {
+            float y = mB0 * x + mB1 * mX1 + mB2 * mX2 - mA1 * mY1 - mA2 * mY2;
+            mX2 = mX1;
+            mX1 = x;
+            mY2 = mY1;
+            mY1 = y;
+            return y;
+        }
+
+        /**
+         * @brief Filter a block of samples in place.
+         * @param data Input samples, replaced by the filtered output.
+         * @param n Number of samples.
+         * @note Same result as calling update() on each sample, with the state kept in
+         * registers. First-order designs (b2 = a2 = 0) skip the second-order terms, which
+         * shortens the recursive dependency chain.
+         */
+        void process(float* data, size_t n);
+
+        /**
+         * @brief Replace the coefficients, keeping the current state.
+         */
+        void setCoefficients(float b0, float b1, float b2, float a1, float a2);
+
+        /**
+         * @brief Last filtered output.
+         */
+        float output() const { return mY1; }
+
+        /**
+         * @brief Last input sample (in SpeedEstimator, the unfiltered speed in RPM).
+         */
+        float input() const { return mX1; }
+
+        /**
+         * @brief Clear the filter state.
+         */
+        void reset();
+
+        float b0() const { return mB0; }
+        float b1() const { return mB1; }
+        float b2() const { return mB2; }
+        float a1() const { return mA1; }
+        float a2() const { return mA2; }
+};
+
+#endif
@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file InputCapture.cpp
+ * @brief Implementation of the AvrInputCapture class.
+ */
+
+#include "InputCapture.h"
+
+#if defined(__AVR__) && defined(ICR1)
+void AvrInputCapture::begin(bool risingEdge, bool noiseCanceler) {
+    uint8_t oldSREG = SREG;
+    cli();
+    TCCR1B = 0; // Stop the timer while configuring it
+    TCCR1A = 0; // Normal mode, no output compare
+    TCNT1 = 0;
+    mExtender.reset();
+    mSnapshot.write(0, 0);
+    TIFR1 = _BV(ICF1) | _BV(TOV1); // Clear stale flags
+    TIMSK1 = _BV(ICIE1) | _BV(TOIE1);
+    TCCR1B = _BV(CS10) | (risingEdge ? _BV(ICES1) : 0) | (noiseCanceler ? _BV(ICNC1) : 0);
+    SREG = oldSREG;
+}
+#endif
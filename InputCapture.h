@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file InputCapture.h
+ * @brief Hardware edge timestamping with the AVR Timer1 input capture unit (ICP1).
+ *
+ * micros() on a 16 MHz AVR has a 4 us resolution and disables interrupts while it
+ * is read. With input capture, Timer1 latches the edge time in ICR1 in hardware,
+ * at the CPU clock (62.5 ns at 16 MHz). The 16-bit capture is extended to 32 bits
+ * with the Timer1 overflow interrupt and published, together with the pulse count,
+ * in an EncoderSnapshot for the period and M/T estimation modes.
+ *
+ * The 32-bit extension logic (CaptureTimeExtender) does not depend on the AVR
+ * registers, so it is unit-tested on the host with a register model.
+ */
+
+#ifndef __INPUTCAPTURE_H__
+#define __INPUTCAPTURE_H__
+
+#include <stdint.h>
+#include "EncoderSnapshot.h"
+
+#if defined(__AVR__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+/**
+ * @class CaptureTimeExtender
+ * @brief Extends 16-bit timer values to 32 bits with the timer overflow interrupt.
+ *
+ * The capture interrupt has a higher priority than the overflow interrupt, so a
+ * capture can be serviced while an overflow is pending. In that case the capture
+ * belongs to the new timer period only if its value is small (it was latched after
+ * the wrap); a large value was latched just before the wrap.
+ */
+class CaptureTimeExtender {
+    private:
+        volatile uint16_t mOverflows; ///< Serviced timer overflows (high 16 bits of the time).
+
+    public:
+        CaptureTimeExtender() : mOverflows(0) {}
+
+        /**
+         * @brief Account for a timer overflow. Call it from the overflow ISR.
+         */
+        void onOverflow() { mOverflows++; }
+
+        /**
+         * @brief Extend a 16-bit timer value to 32 bits.
+         * @param timerValue Captured (ICR1) or current (TCNT1) timer value.
+         * @param overflowPending True if the overflow flag is set but its ISR has not run.
+         * @note Must be called with interrupts disabled (e.g. from the capture ISR).
+         */
+        uint32_t extend(uint16_t timerValue, bool overflowPending) const {
+            uint16_t high = mOverflows;
+            if (overflowPending && timerValue < 0x8000) {
+                high++;
+            }
+            return ((uint32_t)high << 16) | timerValue;
+        }
+
+        void reset() { mOverflows = 0; }
+};
+
+#if defined(__AVR__) && defined(ICR1)
+/**
+ * @class AvrInputCapture
+ * @brief Timer1 input capture backend: counts ICP1 edges and timestamps them in CPU clock ticks.
+ *
+ * Timer1 is taken over entirely. The ISRs must be defined by the sketch:
+ * @code
+ * AvrInputCapture capture;
+ *
+ * ISR(TIMER1_CAPT_vect) { capture.onCapture(); }
+ * ISR(TIMER1_OVF_vect) { capture.onOverflow(); }
+ *
+ * void setup() {
+ *     speedEstimator.setTimestampRate(AvrInputCapture::TICKS_PER_SECOND);
+ *     capture.begin();
+ * }
+ *
+ * void loop() {
+ *     float speed = speedEstimator.estimateSpeed(capture.snapshot(), capture.now());
+ * }
+ * @endcode
+ */
+class AvrInputCapture {
+    private:
+        CaptureTimeExtender mExtender; ///< 16 to 32-bit time extension.
+        EncoderSnapshot mSnapshot; ///< Edge count and timestamp of the last edge (ticks).
+
+    public:
+        static const uint32_t TICKS_PER_SECOND = F_CPU; ///< Timer1 runs at the CPU clock.
+
+        /**
+         * @brief Configure Timer1 (normal mode, no prescaler, capture on ICP1 edges).
+         * @param risingEdge Capture rising (true) or falling (false) edges.
+         * @param noiseCanceler Enable the 4-sample input noise canceler (adds 4 ticks of delay).
+         */
+        void begin(bool risingEdge = true, bool noiseCanceler = false);
+
+        /**
+         * @brief Latch the edge time. Call it from ISR(TIMER1_CAPT_vect).
+         */
+        void onCapture() {
+            uint16_t captured = ICR1;
+            uint32_t timestamp = mExtender.extend(captured, (TIFR1 & _BV(TOV1)) != 0);
+            mSnapshot.increment(1, timestamp);
+        }
+
+        /**
+         * @brief Call it from ISR(TIMER1_OVF_vect).
+         */
+        void onOverflow() { mExtender.onOverflow(); }
+
+        /**
+         * @brief Current time in ticks, on the same time base as the edge timestamps.
+         */
+        uint32_t now() {
+            uint8_t oldSREG = SREG;
+            cli();
+            uint16_t timerValue = TCNT1;
+            uint32_t timestamp = mExtender.extend(timerValue, (TIFR1 & _BV(TOV1)) != 0);
+            SREG = oldSREG;
+            return timestamp;
+        }
+
+        /**
+         * @brief Edge count and timestamp of the last edge (ticks).
+         */
+        const EncoderSnapshot& snapshot() const { return mSnapshot; }
+};
+#endif
+
+#endif
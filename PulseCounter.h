@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file PulseCounter.h
+ * @brief Pulse counter backends feeding SpeedEstimator.
+ *
+ * A PulseCounter provides the running encoder count. Two kinds of backends exist:
+ * - SoftwarePulseCounter: the count is incremented by a user ISR (fallback, works on
+ *   any board but costs one interrupt per edge).
+ * - ExtendedPulseCounter: the count comes from a 16-bit hardware counter peripheral
+ *   (see HardwarePulseCounters.h), extended to 32 bits with its wrap interrupt, so
+ *   edges are counted without CPU load.
+ *
+ * Hardware access goes through the Counter16Hal interface, so the extension logic
+ * can be unit-tested on a host with a mock HAL.
+ */
+
+#ifndef __PULSECOUNTER_H__
+#define __PULSECOUNTER_H__
+
+#include <stdint.h>
+#include "EncoderSnapshot.h"
+
+/**
+ * @class PulseCounter
+ * @brief Source of the running encoder count.
+ */
+class PulseCounter {
+    public:
+        /**
+         * @brief Configure the counter (peripheral setup, counter cleared).
+         */
+        virtual void begin() = 0;
+
+        /**
+         * @brief Current count, consistent with respect to the counter interrupts.
+         */
+        virtual int32_t read() = 0;
+
+    protected:
+        ~PulseCounter() {}
+};
+
+/**
+ * @class SoftwarePulseCounter
+ * @brief Count maintained by a user ISR (fallback backend).
+ *
+ * The count is published through an EncoderSnapshot, so read() never disables interrupts.
+ */
+class SoftwarePulseCounter : public PulseCounter {
+    private:
+        EncoderSnapshot mSnapshot; ///< Count and last edge timestamp.
+
+    public:
+        void begin() { mSnapshot.write(0, 0); }
+
+        /**
+         * @brief Add a count step. Call it from the encoder ISR.
+         * @param step Count step (e.g. the value returned by QuadratureDecoder::update()).
+         * @param timestamp Edge timestamp, available through snapshot() for the period and M/T modes.
+         */
+        void add(int32_t step, uint32_t timestamp = 0) { mSnapshot.increment(step, timestamp); }
+
+        int32_t read() {
+            int32_t count;
+            uint32_t timestamp;
+            mSnapshot.read(count, timestamp);
+            return count;
+        }
+
+        /**
+         * @brief Count and edge timestamp, e.g. for SpeedEstimator::estimateSpeed(const EncoderSnapshot&).
+         */
+        const EncoderSnapshot& snapshot() const { return mSnapshot; }
+};
+
+/**
+ * @class Counter16Hal
+ * @brief Hardware abstraction of a 16-bit pulse counter peripheral.
+ */
+class Counter16Hal {
+    public:
+        /**
+         * @brief Configure the peripheral and clear the counter.
+         */
+        virtual void configure() = 0;
+
+        /**
+         * @brief Raw counter value (0..65535 for up-counters, signed for up/down counters).
+         */
+        virtual int32_t readRaw() = 0;
+
+        /**
+         * @brief Direction of a wrap flagged by the hardware whose interrupt has not been serviced yet.
+         * @return +1 (overflow), -1 (underflow) or 0 (none pending).
+         */
+        virtual int8_t pendingWrap() = 0;
+
+    protected:
+        ~Counter16Hal() {}
+};
+
+/**
+ * @class ExtendedPulseCounter
+ * @brief Extends a 16-bit hardware counter to 32 bits with its wrap interrupt.
+ *
+ * The wrap ISR must call onWrap(). read() combines the serviced wraps with the raw
+ * value and resolves the race where the hardware wrapped but its interrupt has not
+ * run yet: the pending wrap is only added if the raw value was read after it,
+ * i.e. if the raw value is still close to the value the counter restarts from (0).
+ */
+class ExtendedPulseCounter : public PulseCounter {
+    private:
+        Counter16Hal& mHal; ///< Hardware access.
+        int32_t mWrapSpan; ///< Counts per wrap (65536 for a free-running 16-bit up-counter).
+        volatile int32_t mWrapped; ///< Sum of the serviced wraps, in counts.
+
+    public:
+        /**
+         * @brief Constructor for ExtendedPulseCounter.
+         * @param hal Hardware access.
+         * @param wrapSpan Counts per wrap.
+         */
+        ExtendedPulseCounter(Counter16Hal& hal, int32_t wrapSpan) : mHal(hal), mWrapSpan(wrapSpan), mWrapped(0) {}
+
+        void begin() {
+            mWrapped = 0;
+            mHal.configure();
+        }
+
+        /**
+         * @brief Account for a counter wrap. Call it from the wrap (overflow/limit) ISR.
+         * @param direction +1 for an overflow, -1 for an underflow.
+         */
+        void onWrap(int8_t direction) { mWrapped += direction * mWrapSpan; }
+
+        int32_t read() {
+            for (;;) {
+                int32_t wrapped = mWrapped;
+                int32_t raw = mHal.readRaw();
+                int8_t pending = mHal.pendingWrap();
+                if (wrapped != mWrapped) {
+                    // The wrap ISR ran meanwhile
+                    continue;
+                }
+                if (pending != 0 && raw < mWrapSpan / 2 && raw > -mWrapSpan / 2) {
+                    wrapped += pending * mWrapSpan;
+                }
+                return wrapped + raw;
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file QuadratureDecoder.cpp
+ * @brief Implementation of the QuadratureDecoder class.
+ */
+
+#include "QuadratureDecoder.h"
+
+// Transition tables indexed by (previous AB << 2) | current AB, with A as bit 1.
+// Forward rotation (A leads B): 00 -> 10 -> 11 -> 01 -> 00.
+
+// 4x: every valid single-channel transition counts; double transitions are invalid
+static const int8_t TABLE_4X[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+// 2x: only A transitions count (B is not interrupting, so B may have moved in between);
+// the direction is forward when A differs from B after the edge
+static const int8_t TABLE_2X[16] = {0, 0, 1, -1, 0, 0, 1, -1, -1, 1, 0, 0, -1, 1, 0, 0};
+
+// 1x: called on A rising edges only; the direction is given by B
+static const int8_t TABLE_1X[16] = {0, 0, 1, -1, 0, 0, 1, -1, 0, 0, 1, -1, 0, 0, 1, -1};
+
+QuadratureDecoder::QuadratureDecoder(uint8_t pinA, uint8_t pinB, QuadratureResolution resolution)
+    : mPortA(nullptr), mPortB(nullptr), mMaskA(0), mMaskB(0), mTable(TABLE_4X), mState(0), mCount(0),
+      mPinA(pinA), mPinB(pinB), mResolution(resolution) {
+    if (resolution == QUADRATURE_1X) {
+        mTable = TABLE_1X;
+    } else if (resolution == QUADRATURE_2X) {
+        mTable = TABLE_2X;
+    }
+}
+
+void QuadratureDecoder::begin(bool pullup) {
+    pinMode(mPinA, pullup ? INPUT_PULLUP : INPUT);
+    pinMode(mPinB, pullup ? INPUT_PULLUP : INPUT);
+
+    mPortA = (volatile QuadraturePort*)portInputRegister(digitalPinToPort(mPinA));
+    mPortB = (volatile QuadraturePort*)portInputRegister(digitalPinToPort(mPinB));
+    mMaskA = (QuadraturePort)digitalPinToBitMask(mPinA);
+    mMaskB = (QuadraturePort)digitalPinToBitMask(mPinB);
+
+    mState = ((*mPortA & mMaskA) ? 2 : 0) | ((*mPortB & mMaskB) ? 1 : 0);
+}
+
+void QuadratureDecoder::attach(void (*isr)()) {
+    attachInterrupt(digitalPinToInterrupt(mPinA), isr, (mResolution == QUADRATURE_1X) ? RISING : CHANGE);
+    if (mResolution == QUADRATURE_4X) {
+        attachInterrupt(digitalPinToInterrupt(mPinB), isr, CHANGE);
+    }
+}
+
+void QuadratureDecoder::detach() {
+    detachInterrupt(digitalPinToInterrupt(mPinA));
+    if (mResolution == QUADRATURE_4X) {
+        detachInterrupt(digitalPinToInterrupt(mPinB));
+    }
+}
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file QuadratureDecoder.h
+ * @brief Table-driven quadrature encoder decoder for use inside the encoder ISR.
+ *
+ * Both channels are read with direct port register reads (no digitalRead()), and
+ * the count is updated through a 16-entry table indexed by the previous and the
+ * current channel state, which gives the direction of rotation and rejects
+ * invalid (bouncing) transitions. The ISR path is a couple of port reads, a
+ * shift, a table lookup and an addition.
+ *
+ * Resolutions:
+ * - QUADRATURE_1X: interrupt on the rising edges of channel A.
+ * - QUADRATURE_2X: interrupt on both edges of channel A.
+ * - QUADRATURE_4X: interrupt on both edges of both channels.
+ *
+ * @note On a 16 MHz AVR, attachInterrupt() adds its own dispatch overhead. To
+ * sustain more than 100k edges/s, call update() from a dedicated ISR
+ * (e.g. ISR(INT0_vect)) instead.
+ */
+
+#ifndef __QUADRATUREDECODER_H__
+#define __QUADRATUREDECODER_H__
+
+#include <Arduino.h>
+
+#if defined(__AVR__)
+typedef uint8_t QuadraturePort; ///< Width of a GPIO input register.
+#else
+typedef uint32_t QuadraturePort; ///< Width of a GPIO input register.
+#endif
+
+/**
+ * @brief Counts per encoder cycle.
+ */
+enum QuadratureResolution {
+    QUADRATURE_1X = 1,
+    QUADRATURE_2X = 2,
+    QUADRATURE_4X = 4
+};
+
+/**
+ * @class QuadratureDecoder
+ * @brief Quadrature decoder with direction detection and selectable 1x/2x/4x resolution.
+ *
+ * Example usage:
+ * @code
+ * QuadratureDecoder decoder(ENCA, ENCB, QUADRATURE_4X);
+ * EncoderSnapshot encoder;
+ *
+ * void readEncoder() {
+ *     int8_t step = decoder.update();
+ *     if (step != 0) {
+ *         encoder.increment(step, micros());
+ *     }
+ * }
+ *
+ * void setup() {
+ *     decoder.begin();
+ *     decoder.attach(readEncoder);
+ * }
+ * @endcode
+ */
+class QuadratureDecoder {
+    private:
+        volatile QuadraturePort* mPortA; ///< Input register of channel A.
+        volatile QuadraturePort* mPortB; ///< Input register of channel B.
+        QuadraturePort mMaskA; ///< Bit mask of channel A in its input register.
+        QuadraturePort mMaskB; ///< Bit mask of channel B in its input register.
+        const int8_t* mTable; ///< Transition table for the selected resolution.
+        uint8_t mState; ///< Previous state (A << 1 | B) in bits 1..0.
+        volatile int32_t mCount; ///< Decoded position in counts.
+
+        uint8_t mPinA; ///< Channel A pin.
+        uint8_t mPinB; ///< Channel B pin.
+        QuadratureResolution mResolution; ///< Counts per encoder cycle.
+
+    public:
+        /**
+         * @brief Constructor for QuadratureDecoder.
+         * @param pinA Channel A pin (must support external interrupts).
+         * @param pinB Channel B pin (must support external interrupts in 4x mode).
+         * @param resolution Counts per encoder cycle.
+         */
+        QuadratureDecoder(uint8_t pinA, uint8_t pinB, QuadratureResolution resolution = QUADRATURE_4X);
+
+        /**
+         * @brief Configure the pins, resolve their port registers and latch the initial state.
+         * @param pullup Enable the internal pull-ups (open-collector encoders).
+         */
+        void begin(bool pullup = false);
+
+        /**
+         * @brief Attach the user ISR to the pins and edges required by the resolution.
+         * @param isr Function calling update().
+         */
+        void attach(void (*isr)());
+
+        /**
+         * @brief Detach the interrupts attached by attach().
+         */
+        void detach();
+
+        /**
+         * @brief Decode the current channel state. Call it from the encoder ISR.
+         * @return The count step: +1, -1, or 0 for no/invalid transition.
+         */
+        int8_t update() {
+            uint8_t ab = ((*mPortA & mMaskA) ? 2 : 0) | ((*mPortB & mMaskB) ? 1 : 0);
+            mState = (uint8_t)((mState << 2) | ab) & 0x0F;
+            int8_t step = mTable[mState];
+            mCount += step;
+            return step;
+        }
+
+        /**
+         * @brief Decoded position in counts.
+         * @note Not atomic on 8-bit targets; publish the count through an EncoderSnapshot
+         * to read it from the loop without disabling interrupts.
+         */
+        int32_t count() const { return mCount; }
+
+        /**
+         * @brief Set the decoded position.
+         */
+        void setCount(int32_t count) { mCount = count; }
+
+        /**
+         * @brief Counts per encoder cycle.
+         */
+        QuadratureResolution resolution() const { return mResolution; }
+};
+
+#endif
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SamplingScheduler.cpp
+ * @brief Implementation of the sampling schedulers.
+ */
+
+#include "SamplingScheduler.h"
+
+SamplingScheduler::SamplingScheduler(uint32_t periodMicros)
+    : mPeriod(periodMicros > 0 ? periodMicros : 1), mDeadline(0), mSamples(0), mOverruns(0), mLateness(0),
+      mMaxLateness(0) {}
+
+void SamplingScheduler::begin(uint32_t now) {
+    mDeadline = now;
+    mSamples = 0;
+    mOverruns = 0;
+    mLateness = 0;
+    mMaxLateness = 0;
+}
+
+bool SamplingScheduler::poll(uint32_t now) {
+    // Signed difference: valid across the micros() wrap
+    int32_t late = (int32_t)(now - mDeadline);
+    if (late < 0) {
+        return false;
+    }
+
+    uint32_t lateness = (uint32_t)late;
+    if (lateness >= mPeriod) {
+        // One or more following deadlines have passed too: skip them, keeping the phase
+        uint32_t missed = lateness / mPeriod;
+        mOverruns += missed;
+        mDeadline += missed * mPeriod;
+        lateness -= missed * mPeriod;
+    }
+    mDeadline += mPeriod;
+    mLateness = lateness;
+    if (lateness > mMaxLateness) {
+        mMaxLateness = lateness;
+    }
+    mSamples++;
+    return true;
+}
+
+void SamplingScheduler::setPeriod(uint32_t periodMicros) {
+    if (periodMicros == 0) {
+        periodMicros = 1;
+    }
+    mDeadline = mDeadline - mPeriod + periodMicros;
+    mPeriod = periodMicros;
+}
+
+TickScheduler::TickScheduler(uint8_t ticksPerSample)
+    : mDue(0), mTickCount(0), mTicksPerSample(ticksPerSample > 0 ? ticksPerSample : 1), mServed(0), mSamples(0),
+      mOverruns(0) {}
+
+#if defined(__AVR__) && defined(OCR2A)
+void AvrTimer2Tick::begin() {
+    uint8_t oldSREG = SREG;
+    cli();
+    TCCR2A = _BV(WGM21); // CTC, TOP = OCR2A
+#if F_CPU == 8000000L
+    TCCR2B = _BV(CS21) | _BV(CS20); // F_CPU / 32: 250 kHz
+#elif F_CPU == 16000000L
+    TCCR2B = _BV(CS22); // F_CPU / 64: 250 kHz
+#else
+#error "AvrTimer2Tick needs F_CPU of 8 or 16 MHz for an exact 1 kHz tick"
+#endif
+    OCR2A = 249; // 250 counts: 1 ms
+    TCNT2 = 0;
+    TIFR2 = _BV(OCF2A);
+    TIMSK2 = _BV(OCIE2A);
+    SREG = oldSREG;
+}
+
+void AvrTimer2Tick::end() {
+    TIMSK2 &= ~_BV(OCIE2A);
+}
+#endif
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SamplingScheduler.h
+ * @brief Fixed-rate triggering of the estimator updates, without delay().
+ *
+ * A loop paced with delay(10) runs every 10 ms plus the time of everything else in
+ * the loop, and that time varies, while the speed filter is designed for one sample
+ * period. Two schedulers keep the configured period exactly:
+ *
+ * - SamplingScheduler: deadline-based, polled from loop() with micros() (or the
+ *   SPEEDESTIMATOR_CLOCK policy). Each deadline is the previous one plus the period,
+ *   so a late sample does not shift the following ones (no drift).
+ * - TickScheduler: driven by a hardware timer interrupt calling onTick(), e.g.
+ *   AvrTimer2Tick at 1 kHz, polled from loop().
+ *
+ * In both, a sample that could not start before the next one was due is an overrun:
+ * it is counted and skipped rather than run back-to-back, since two estimator updates
+ * a few microseconds apart would see no pulses.
+ */
+
+#ifndef __SAMPLINGSCHEDULER_H__
+#define __SAMPLINGSCHEDULER_H__
+
+#include <Arduino.h>
+#include "SpeedEstimatorClock.h"
+
+/**
+ * @class SamplingScheduler
+ * @brief Deadline-based scheduler with a fixed period.
+ *
+ * Example usage:
+ * @code
+ * SamplingScheduler scheduler(10000); // 10 ms
+ *
+ * void setup() { scheduler.begin(); }
+ *
+ * void loop() {
+ *     if (scheduler.poll()) {
+ *         float speed = speedEstimator.estimateSpeed(encoder);
+ *     }
+ *     // Other work, as long as it returns well within a period
+ * }
+ * @endcode
+ */
+class SamplingScheduler {
+    private:
+        uint32_t mPeriod; ///< Sample period in microseconds.
+        uint32_t mDeadline; ///< Time at which the next sample is due.
+        uint32_t mSamples; ///< Samples triggered.
+        uint32_t mOverruns; ///< Samples skipped because the previous one started too late.
+        uint32_t mLateness; ///< Delay between the deadline and poll() for the last sample.
+        uint32_t mMaxLateness; ///< Largest mLateness since begin().
+
+    public:
+        /**
+         * @param periodMicros Sample period in microseconds (greater than zero).
+         */
+        explicit SamplingScheduler(uint32_t periodMicros);
+
+        /**
+         * @brief Start the schedule: the first sample is due now.
+         * @param now Current time in microseconds.
+         */
+        void begin(uint32_t now);
+
+        /**
+         * @brief Start the schedule with the time of SpeedEstimatorClock.
+         */
+        void begin() { begin(SpeedEstimatorClock::now()); }
+
+        /**
+         * @brief Check whether a sample is due, and consume it.
+         * @param now Current time in microseconds.
+         * @return true at most once per period.
+         * @note Missed periods (when poll() is called more than one period after a
+         * deadline) are counted in overruns(); the schedule keeps its phase.
+         */
+        bool poll(uint32_t now);
+
+        /**
+         * @brief Check whether a sample is due, using SpeedEstimatorClock.
+         */
+        bool poll() { return poll(SpeedEstimatorClock::now()); }
+
+        /**
+         * @brief Change the period; the next sample is due one new period after the last one.
+         */
+        void setPeriod(uint32_t periodMicros);
+
+        uint32_t period() const { return mPeriod; } ///< Sample period in microseconds.
+        uint32_t deadline() const { return mDeadline; } ///< Time at which the next sample is due.
+        uint32_t samples() const { return mSamples; } ///< Samples triggered since begin().
+        uint32_t overruns() const { return mOverruns; } ///< Samples skipped since begin().
+        uint32_t lateness() const { return mLateness; } ///< Start delay of the last sample in microseconds.
+        uint32_t maxLateness() const { return mMaxLateness; } ///< Largest start delay since begin().
+};
+
+/**
+ * @class TickScheduler
+ * @brief Scheduler driven by a periodic hardware timer interrupt.
+ *
+ * The ISR calls onTick(); every ticksPerSample ticks a sample is due. The ISR and the
+ * loop each write their own counter, so neither disables interrupts.
+ *
+ * Example usage (AVR, 10 ms from a 1 kHz Timer2 tick):
+ * @code
+ * TickScheduler scheduler(10);
+ *
+ * ISR(TIMER2_COMPA_vect) { scheduler.onTick(); }
+ *
+ * void setup() { AvrTimer2Tick::begin(); }
+ *
+ * void loop() {
+ *     if (scheduler.poll()) {
+ *         float speed = speedEstimator.estimateSpeed(encoder);
+ *     }
+ * }
+ * @endcode
+ */
+class TickScheduler {
+    private:
+        volatile uint8_t mDue; ///< Samples due, wrapping (written by the ISR only).
+        uint8_t mTickCount; ///< Ticks since the last due sample (ISR only).
+        uint8_t mTicksPerSample; ///< Timer ticks per sample period.
+        uint8_t mServed; ///< Samples consumed by poll(), wrapping (loop only).
+        uint32_t mSamples; ///< Samples triggered.
+        uint32_t mOverruns; ///< Samples skipped because poll() was called too late.
+
+    public:
+        /**
+         * @param ticksPerSample Timer ticks per sample period (at least 1).
+         */
+        explicit TickScheduler(uint8_t ticksPerSample = 1);
+
+        /**
+         * @brief Count one timer tick (from the timer ISR).
+         */
+        void onTick() {
+            uint8_t count = mTickCount + 1;
+            if (count >= mTicksPerSample) {
+                count = 0;
+                mDue = mDue + 1;
+            }
+            mTickCount = count;
+        }
+
+        /**
+         * @brief Check whether a sample is due, and consume it (from the loop).
+         * @return true at most once per tick period; samples missed meanwhile are
+         * counted in overruns() (up to 255 between two calls).
+         */
+        bool poll() {
+            uint8_t due = mDue;
+            uint8_t pending = (uint8_t)(due - mServed);
+            if (pending == 0) {
+                return false;
+            }
+            mServed = due;
+            mOverruns += pending - 1;
+            mSamples++;
+            return true;
+        }
+
+        uint32_t samples() const { return mSamples; } ///< Samples triggered.
+        uint32_t overruns() const { return mOverruns; } ///< Samples skipped.
+};
+
+#if defined(__AVR__) && defined(OCR2A)
+/**
+ * @class AvrTimer2Tick
+ * @brief Timer2 in CTC mode interrupting at exactly 1 kHz (F_CPU of 8 or 16 MHz; other
+ * clocks are rejected at compile time).
+ *
+ * The sketch defines ISR(TIMER2_COMPA_vect) and calls TickScheduler::onTick() from it.
+ * Timer2 is taken over entirely: tone() and PWM on pins 3/11 (9/10 on Mega) are not
+ * available.
+ */
+class AvrTimer2Tick {
+    public:
+        static const uint32_t TICK_MICROS = 1000; ///< Tick period.
+
+        static void begin();
+        static void end();
+};
+#endif
+
+#endif
@@ -9,43 +9,291 @@
 
 #include "SpeedEstimator.h"
 
-SpeedEstimator::SpeedEstimator(float ppr, float gearRatio)
-    : mPrevTime(0), mPrevNumPulses(0), mSpeedFilt(0), mSpeedPrev(0), mPpr(ppr), mGearRatio(gearRatio) {}
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+// Cycle cost and interval of each call (see SpeedEstimatorStats.h)
+#define SPEEDESTIMATOR_PROBE_START() uint32_t probeStart = SpeedEstimatorCycleCounter::now()
+#define SPEEDESTIMATOR_PROBE_END(deltaTime) mStats.record((deltaTime), SpeedEstimatorCycleCounter::now() - probeStart)
+#else
+#define SPEEDESTIMATOR_PROBE_START() do {} while (0)
+#define SPEEDESTIMATOR_PROBE_END(deltaTime) do {} while (0)
+#endif
+
+SpeedEstimator::SpeedEstimator(float ppr, float gearRatio, const IIRFilter& filter)
+    : mCore(filter), mAdaptiveTable(nullptr), mRpmScale(SpeedEstimatorCore::rpmScale(ppr, gearRatio)),
+      mTimestampRate(1000000UL), mMicrosPerTick(1.0f),
+      mPrevEdgeTime(0), mEdgeSpan(0), mEdgeSpanPulses(0), mEdgeSeen(false), mDirection(1), mPeriodTimeout(1000000UL), mFixedPeriod(0), mFixedScale(0) {
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+    mCheckTime = 0;
+    mCheckedPeriod = 0;
+    mPeriodDeviations = 0;
+#endif
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+    mStatsTime = 0;
+#endif
+}
 
 float SpeedEstimator::estimateSpeed(int pulsesCount) {
-    unsigned long currTime = micros();
-    // Handle micros() overflow: unsigned arithmetic automatically wraps correctly
-    unsigned long deltaTimeMicros = currTime - mPrevTime;
-    float deltaTime = ((float)deltaTimeMicros) / 1.0e6;
+    if (mFixedPeriod != 0) {
+        return estimateSpeedFixed(pulsesCount);
+    }
+    return estimateSpeed(pulsesCount, SpeedEstimatorClock::now());
+}
+
+float SpeedEstimator::estimateSpeedFixed(int pulsesCount) {
+    SPEEDESTIMATOR_PROBE_START();
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+    // Debug check: the real period must match the nominal one
+    uint32_t now = SpeedEstimatorClock::now();
+    if (mCheckTime != 0) {
+        mCheckedPeriod = now - mCheckTime;
+        uint32_t deviation = (mCheckedPeriod > mFixedPeriod) ? mCheckedPeriod - mFixedPeriod : mFixedPeriod - mCheckedPeriod;
+        if ((uint64_t)deviation * 100U > (uint64_t)mFixedPeriod * (SPEEDESTIMATOR_PERIOD_CHECK)) {
+            mPeriodDeviations++;
+        }
+    }
+    mCheckTime = (now != 0) ? now : 1; // 0 marks the first call
+#endif
+
+    float speed = filterVelocity((float)mCore.pulseDiff(pulsesCount) * mFixedScale, mFixedPeriod);
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+    // The first call has no previous one to measure the interval from: not recorded
+    uint32_t statsNow = SpeedEstimatorClock::now();
+    if (mStatsTime != 0) {
+        SPEEDESTIMATOR_PROBE_END(statsNow - mStatsTime);
+    }
+    mStatsTime = (statsNow != 0) ? statsNow : 1; // 0 marks the first call
+#endif
+    return speed;
+}
+
+float SpeedEstimator::estimateSpeed(int pulsesCount, uint32_t timestampMicros) {
+    SPEEDESTIMATOR_PROBE_START();
+    // Handle timestamp overflow: unsigned arithmetic automatically wraps correctly
+    uint32_t deltaTime = mCore.advance(timestampMicros);
+
+    if (deltaTime == 0) {
+        // Avoid division by zero
+        SPEEDESTIMATOR_PROBE_END(0);
+        return mCore.output();
+    }
+
+    // Handle pulse counter overflow by calculating the signed difference, then
+    // convert counts/us to RPM with the precomputed scale (single division)
+    float velocity = SpeedEstimatorCore::velocity(mCore.pulseDiff(pulsesCount), mRpmScale, deltaTime);
+
+    // The adaptive table and the statistics work in microseconds
+    uint32_t deltaTimeMicros = toMicros(deltaTime);
+    float speed = filterVelocity(velocity, deltaTimeMicros);
+    SPEEDESTIMATOR_PROBE_END(deltaTimeMicros);
+    return speed;
+}
+
+float SpeedEstimator::estimateSpeedFromPeriod(int pulsesCount, uint32_t lastEdgeMicros,
+                                              uint32_t edgePeriodMicros) {
+    return estimateSpeedFromPeriod(pulsesCount, lastEdgeMicros, edgePeriodMicros, SpeedEstimatorClock::now());
+}
+
+float SpeedEstimator::estimateSpeedFromPeriod(int pulsesCount, uint32_t lastEdgeMicros,
+                                              uint32_t edgePeriodMicros, uint32_t nowMicros) {
+    SPEEDESTIMATOR_PROBE_START();
+    uint32_t deltaTime = mCore.advance(nowMicros);
+
+    if (deltaTime == 0) {
+        // Same sample as the previous call
+        SPEEDESTIMATOR_PROBE_END(0);
+        return mCore.output();
+    }
+
+    // The pulse count only provides the direction of rotation
+    int pulseDiff = mCore.pulseDiff(pulsesCount);
+    if (pulseDiff > 0) {
+        mDirection = 1;
+    } else if (pulseDiff < 0) {
+        mDirection = -1;
+    }
+
+    // While no new edge arrives, the true period is at least the time since the last edge
+    uint32_t sinceLastEdge = nowMicros - lastEdgeMicros;
+    uint32_t period = (sinceLastEdge > edgePeriodMicros) ? sinceLastEdge : edgePeriodMicros;
+
+    float velocity = 0;
+    if (edgePeriodMicros != 0 && sinceLastEdge < mPeriodTimeout) {
+        velocity = (float)mDirection * mRpmScale / (float)period;
+    }
+
+    uint32_t deltaTimeMicros = toMicros(deltaTime);
+    float speed = filterVelocity(velocity, deltaTimeMicros);
+    SPEEDESTIMATOR_PROBE_END(deltaTimeMicros);
+    return speed;
+}
+
+float SpeedEstimator::estimateSpeedMT(int pulsesCount, uint32_t lastEdgeMicros) {
+    return estimateSpeedMT(pulsesCount, lastEdgeMicros, SpeedEstimatorClock::now());
+}
 
-    if (deltaTime <= 0) {
-        // Avoid division by zero or negative time intervals
-        return mSpeedFilt;
+float SpeedEstimator::estimateSpeedMT(int pulsesCount, uint32_t lastEdgeMicros, uint32_t nowMicros) {
+    SPEEDESTIMATOR_PROBE_START();
+    uint32_t deltaTime = mCore.advance(nowMicros);
+
+    if (deltaTime == 0) {
+        // Same sample as the previous call
+        SPEEDESTIMATOR_PROBE_END(0);
+        return mCore.output();
+    }
+
+    int pulseDiff = mCore.pulseDiff(pulsesCount);
+    float velocity = 0;
+
+    if (pulseDiff != 0) {
+        mDirection = (pulseDiff > 0) ? 1 : -1;
+
+        // Exactly pulseDiff pulses happened between the last edges of both windows
+        // (the first edge after construction or reset has no reference edge)
+        uint32_t edgeSpanMicros = lastEdgeMicros - mPrevEdgeTime;
+        if (mEdgeSeen && edgeSpanMicros != 0) {
+            velocity = ((float)pulseDiff) * mRpmScale / ((float)edgeSpanMicros);
+            mEdgeSpan = edgeSpanMicros;
+            mEdgeSpanPulses = (pulseDiff > 0) ? (uint32_t)pulseDiff : 0U - (uint32_t)pulseDiff;
+        }
+        mPrevEdgeTime = lastEdgeMicros;
+        mEdgeSeen = true;
+    } else if (mEdgeSpan != 0) {
+        // No edge in this window: the period is at least the last measured one,
+        // and at least the time since the last edge
+        uint32_t sinceLastEdge = nowMicros - mPrevEdgeTime;
+        if (sinceLastEdge < mPeriodTimeout) {
+            float period = (float)mEdgeSpan / (float)mEdgeSpanPulses;
+            if ((float)sinceLastEdge > period) {
+                period = (float)sinceLastEdge;
+            }
+            velocity = (float)mDirection * mRpmScale / period;
+        }
     }
 
-    // Handle pulse counter overflow by calculating the signed difference
-    // If pulsesCount wrapped around, this correctly computes the difference
-    int pulseDiff = pulsesCount - mPrevNumPulses;
-    float velocity = ((float)pulseDiff) / deltaTime;
-    
-    mPrevNumPulses = pulsesCount;
-    mPrevTime = currTime;
+    uint32_t deltaTimeMicros = toMicros(deltaTime);
+    float speed = filterVelocity(velocity, deltaTimeMicros);
+    SPEEDESTIMATOR_PROBE_END(deltaTimeMicros);
+    return speed;
+}
 
-    // Convert counts/s to RPM (60 seconds per minute)
-    velocity = (velocity / mPpr) * (1.0 / mGearRatio) * 60.0;
+float SpeedEstimator::estimateSpeed(const EncoderSnapshot& snapshot) {
+    int32_t count;
+    uint32_t lastEdgeMicros;
+    snapshot.read(count, lastEdgeMicros);
+    return estimateSpeedMT((int)count, lastEdgeMicros, SpeedEstimatorClock::now());
+}
 
-    // Low-pass filter
-    // TODO: Tune filter coefficients as needed, or expand the
-    // class to allow user-defined coefficients
-    mSpeedFilt = 0.7265 * mSpeedFilt + 0.1367 * velocity + 0.1367 * mSpeedPrev;
-    mSpeedPrev = velocity;
+float SpeedEstimator::estimateSpeed(const EncoderSnapshot& snapshot, uint32_t now) {
+    int32_t count;
+    uint32_t lastEdge;
+    snapshot.read(count, lastEdge);
+    return estimateSpeedMT((int)count, lastEdge, now);
+}
 
-    return mSpeedFilt;
+float SpeedEstimator::estimateSpeed(PulseCounter& counter) {
+    return estimateSpeed((int)counter.read(), SpeedEstimatorClock::now());
+}
+
+void SpeedEstimator::estimateSpeedBatch(const int32_t* counts, const uint32_t* timestamps, float* out, size_t n) {
+    if (mAdaptiveTable != nullptr) {
+        // Per-sample coefficients need the scalar path
+        for (size_t i = 0; i < n; i++) {
+            out[i] = estimateSpeed((int)counts[i], timestamps[i]);
+        }
+        return;
+    }
+
+    // Blocks small enough for the velocities to stay in L1 between both passes
+    const size_t BLOCK = 256;
+    // Locals cannot alias the output buffer, so they stay in registers
+    const float rpmScale = mRpmScale;
+
+    for (size_t start = 0; start < n; start += BLOCK) {
+        size_t length = (n - start < BLOCK) ? (n - start) : BLOCK;
+        const int32_t* blockCounts = counts + start;
+        const uint32_t* blockTimes = timestamps + start;
+        float* blockOut = out + start;
+
+        // Pass 1: differentiation and scaling, no loop-carried dependency
+        uint32_t firstDeltaTime = blockTimes[0] - mCore.prevTime();
+        int32_t firstPulseDiff = (int32_t)((uint32_t)blockCounts[0] - (uint32_t)(int32_t)mCore.prevNumPulses());
+        bool repeatedTime = (firstDeltaTime == 0);
+        blockOut[0] = SpeedEstimatorCore::velocity((int)firstPulseDiff, rpmScale, firstDeltaTime);
+        for (size_t i = 1; i < length; i++) {
+            uint32_t deltaTime = blockTimes[i] - blockTimes[i - 1];
+            int32_t pulseDiff = (int32_t)((uint32_t)blockCounts[i] - (uint32_t)blockCounts[i - 1]);
+            repeatedTime |= (deltaTime == 0);
+            blockOut[i] = SpeedEstimatorCore::velocity((int)pulseDiff, rpmScale, deltaTime);
+        }
+
+        if (repeatedTime) {
+            // Skipped samples need the scalar path
+            for (size_t i = 0; i < length; i++) {
+                blockOut[i] = estimateSpeed((int)blockCounts[i], blockTimes[i]);
+            }
+            continue;
+        }
+
+        // Pass 2: recursive filter
+        mCore.filter().process(blockOut, length);
+        mCore.setPrevious((int)blockCounts[length - 1], blockTimes[length - 1]);
+    }
+}
+
+void SpeedEstimator::setFixedPeriod(uint32_t periodMicros) {
+    mFixedPeriod = periodMicros;
+    // mRpmScale is per timestamp tick: bring it back to microseconds
+    mFixedScale = (periodMicros != 0) ? mRpmScale * (1.0e6f / (float)mTimestampRate) / (float)periodMicros : 0;
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+    mCheckTime = 0;
+#endif
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+    mStatsTime = 0;
+#endif
+}
+
+void SpeedEstimator::setTimestampRate(uint32_t ticksPerSecond) {
+    float ratio = (float)ticksPerSecond / (float)mTimestampRate;
+    mRpmScale *= ratio;
+    mPeriodTimeout = (uint32_t)((float)mPeriodTimeout * ratio);
+    mTimestampRate = ticksPerSecond;
+    mMicrosPerTick = 1.0e6f / (float)ticksPerSecond;
+}
+
+void SpeedEstimator::setPeriodTimeout(uint32_t timeoutMicros) {
+    if (mTimestampRate == 1000000UL) {
+        mPeriodTimeout = timeoutMicros;
+        return;
+    }
+    // Stored in timestamp ticks, saturated to the longest representable timeout
+    float ticks = (float)timeoutMicros / mMicrosPerTick;
+    mPeriodTimeout = (ticks >= 4294967040.0f) ? 0xFFFFFFFFUL : (uint32_t)ticks;
+}
+
+float SpeedEstimator::filterVelocity(float velocity, uint32_t deltaTimeMicros) {
+    // Low-pass filter, optionally with coefficients matching the measured sample time
+    if (mAdaptiveTable != nullptr) {
+        const AdaptiveFilterTable::Coefficients& coeffs = mAdaptiveTable->lookup(deltaTimeMicros);
+        mCore.filter().setCoefficients(coeffs.b, coeffs.b, 0, coeffs.a1, 0);
+    }
+    return mCore.update(velocity);
 }
 
 void SpeedEstimator::reset() {
-    mPrevTime = 0;
-    mPrevNumPulses = 0;
-    mSpeedFilt = 0;
-    mSpeedPrev = 0;
+    mCore.reset();
+    mPrevEdgeTime = 0;
+    mEdgeSpan = 0;
+    mEdgeSpanPulses = 0;
+    mEdgeSeen = false;
+    mDirection = 1;
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+    mCheckTime = 0;
+#endif
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+    mStatsTime = 0;
+#endif
+}
+
+void SpeedEstimator::setFilter(const IIRFilter& filter) {
+    mCore.setFilter(filter);
 }
\ No newline at end of file
@@ -17,6 +17,29 @@
 #define __SPEEDESTIMATOR_H__
 
 #include <Arduino.h>
+#include "SpeedEstimatorClock.h"
+#include "IIRFilter.h"
+#include "SpeedEstimatorCore.h"
+#include "AdaptiveFilterTable.h"
+#include "EncoderSnapshot.h"
+#include "PulseCounter.h"
+#include "SpeedEstimatorStats.h"
+
+// SPEEDESTIMATOR_PERIOD_CHECK and SPEEDESTIMATOR_INSTRUMENTATION add members to
+// SpeedEstimator, so the library and the sketch must be built with the same flags. The
+// class is declared in an inline namespace named after them: with mismatched flags the
+// build fails to link instead of running with two different layouts.
+#if defined(SPEEDESTIMATOR_PERIOD_CHECK) && defined(SPEEDESTIMATOR_INSTRUMENTATION)
+#define SPEEDESTIMATOR_LAYOUT layout_period_check_instrumentation
+#elif defined(SPEEDESTIMATOR_PERIOD_CHECK)
+#define SPEEDESTIMATOR_LAYOUT layout_period_check
+#elif defined(SPEEDESTIMATOR_INSTRUMENTATION)
+#define SPEEDESTIMATOR_LAYOUT layout_instrumentation
+#else
+#define SPEEDESTIMATOR_LAYOUT layout_default
+#endif
+
+inline namespace SPEEDESTIMATOR_LAYOUT {
 
 /**
  * @class SpeedEstimator
@@ -28,37 +51,273 @@
  * @code
  * SpeedEstimator speedEstimator(ppr, gearRatio); // ppr (pulses per revolution), gearRatio
  * float speed = speedEstimator.estimateSpeed(currentPulses);
+ *
+ * // Custom filter: 1 kHz loop with a 20 Hz second-order Butterworth filter
+ * SpeedEstimator fastEstimator(ppr, gearRatio, IIRFilter::butterworth2(20.0f, 0.001f));
  * @endcode
  */
 class SpeedEstimator {
     private:
-        unsigned long mPrevTime; ///< Previous timestamp in microseconds.
-        int mPrevNumPulses; ///< Previous number of pulses.
-        float mSpeedFilt; ///< Filtered velocity.
-        float mSpeedPrev; ///< Previous velocity.
+        SpeedEstimatorCore mCore; ///< Previous sample and low-pass filter, shared with SpeedEstimatorT.
+        const AdaptiveFilterTable* mAdaptiveTable; ///< Coefficients per measured sample time, or nullptr.
+
+        float mRpmScale; ///< RPM * tick per pulse: 60 * timestampRate / (ppr * gearRatio), folded at construction.
+        uint32_t mTimestampRate; ///< Timestamp ticks per second (1e6 for microseconds).
+        float mMicrosPerTick; ///< 1e6 / mTimestampRate, to pass sample times to the table and stats in microseconds.
+
+        uint32_t mPrevEdgeTime; ///< Timestamp of the last edge of the previous window (M/T mode).
+        uint32_t mEdgeSpan; ///< Last measured time between the last edges of two windows, 0 before the first (M/T mode).
+        uint32_t mEdgeSpanPulses; ///< Pulses counted over mEdgeSpan (M/T mode).
+        bool mEdgeSeen; ///< Whether mPrevEdgeTime holds a real edge (M/T mode).
+        int8_t mDirection; ///< Sign of the last non-zero pulse difference (period and M/T modes).
+        uint32_t mPeriodTimeout; ///< Time without edges after which the speed is zero, in timestamp ticks (period and M/T modes).
+
+        uint32_t mFixedPeriod; ///< Nominal call period in microseconds, 0 when the interval is measured.
+        float mFixedScale; ///< RPM per pulse over one mFixedPeriod.
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+        uint32_t mCheckTime; ///< Clock at the previous fixed-period call (0 before the first one).
+        uint32_t mCheckedPeriod; ///< Measured period of the last fixed-period call.
+        uint32_t mPeriodDeviations; ///< Fixed-period calls outside the tolerance.
+#endif
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+        SpeedEstimatorStats mStats; ///< Call timing statistics.
+        uint32_t mStatsTime; ///< Clock at the previous fixed-period call, for mStats.
+#endif
 
-        float mPpr; ///< Pulses per revolution of the encoder.
-        float mGearRatio; ///< Gear ratio of the motor.
+        /**
+         * @brief Shared filter stage for all estimation modes.
+         * @param velocity Raw velocity in RPM.
+         * @param deltaTimeMicros Time since the previous call, for adaptive filtering.
+         */
+        float filterVelocity(float velocity, uint32_t deltaTimeMicros);
+
+        /**
+         * @brief Convert a time in timestamp ticks to microseconds (see setTimestampRate()).
+         */
+        uint32_t toMicros(uint32_t ticks) const {
+            return (mTimestampRate == 1000000UL) ? ticks : (uint32_t)((float)ticks * mMicrosPerTick);
+        }
+
+        /**
+         * @brief Fixed-period estimation: one multiplication, no clock read, no division.
+         */
+        float estimateSpeedFixed(int pulsesCount);
 
     public:
         /**
          * @brief Constructor for SpeedEstimator.
          * @param ppr Pulses per revolution of the encoder.
          * @param gearRatio Gear ratio of the motor.
+         * @param filter Low-pass filter applied to the speed. Defaults to the first-order
+         * Butterworth filter designed for a 10 ms sample time (5 Hz cutoff).
          */
-        SpeedEstimator(float ppr, float gearRatio);
+        SpeedEstimator(float ppr, float gearRatio, const IIRFilter& filter = IIRFilter());
 
         /**
          * @brief Calculate the speed of the motor in RPM.
          * @param pulsesCount The number of pulses counted by the encoder.
          * @return The calculated speed in RPM.
+         * @note The sample is timestamped with the compile-time clock policy
+         * (see SpeedEstimatorClock.h), micros() by default. In fixed-period mode
+         * (setFixedPeriod()), no clock is read and the nominal period is used.
          */
         float estimateSpeed(int pulsesCount);
 
+        /**
+         * @brief Calculate the speed of the motor in RPM from a timestamped sample.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @param timestampMicros Time in microseconds at which pulsesCount was read
+         * (e.g. captured in the encoder ISR together with the count).
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(int pulsesCount, uint32_t timestampMicros);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM from the period between encoder edges (1/T method).
+         * @param pulsesCount The number of pulses counted by the encoder (only its change is
+         * used, to know the direction of rotation).
+         * @param lastEdgeMicros Timestamp of the most recent encoder edge, captured in the ISR.
+         * @param edgePeriodMicros Time between the two most recent edges, captured in the ISR
+         * (0 if fewer than two edges were seen).
+         * @param nowMicros Current time in microseconds.
+         * @return The calculated speed in RPM.
+         * @note Resolution at low speed is given by the timestamp resolution rather than by
+         * the sample window. If no edge arrives for longer than the last period, the elapsed
+         * time is used as the period, so the speed decays towards zero; after the period
+         * timeout it is zero.
+         */
+        float estimateSpeedFromPeriod(int pulsesCount, uint32_t lastEdgeMicros, uint32_t edgePeriodMicros,
+                                      uint32_t nowMicros);
+
+        /**
+         * @brief Same as above, timestamped with the compile-time clock policy.
+         */
+        float estimateSpeedFromPeriod(int pulsesCount, uint32_t lastEdgeMicros, uint32_t edgePeriodMicros);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM with the combined M/T method.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @param lastEdgeMicros Timestamp of the edge that produced the current pulsesCount,
+         * captured in the ISR together with the count.
+         * @param nowMicros Current time in microseconds.
+         * @return The calculated speed in RPM.
+         * @note The pulses counted in the sample window are divided by the exact time between
+         * the last edge of the previous window and the last edge of this one, so the
+         * resolution is good at both low and high speed. In a window without edges the
+         * period is at least the last measured one, and at least the time since the last
+         * edge: the larger of both is used, so the speed decays towards zero once the
+         * encoder stops (see setPeriodTimeout()). The speed is zero until two windows with
+         * edges have been seen.
+         */
+        float estimateSpeedMT(int pulsesCount, uint32_t lastEdgeMicros, uint32_t nowMicros);
+
+        /**
+         * @brief Same as above, timestamped with the compile-time clock policy.
+         */
+        float estimateSpeedMT(int pulsesCount, uint32_t lastEdgeMicros);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM from an encoder snapshot published by the ISR.
+         * @param snapshot Count and edge timestamp written by the encoder ISR. It is read
+         * with the seqlock protocol (retrying instead of disabling interrupts).
+         * @return The calculated speed in RPM, with the M/T method (see estimateSpeedMT()).
+         */
+        float estimateSpeed(const EncoderSnapshot& snapshot);
+
+        /**
+         * @brief Same as above, with the current time supplied by the caller.
+         * @param snapshot Count and edge timestamp written by the encoder ISR.
+         * @param now Current time on the same time base as the snapshot timestamps
+         * (e.g. AvrInputCapture::now()).
+         */
+        float estimateSpeed(const EncoderSnapshot& snapshot, uint32_t now);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM from a pulse counter backend.
+         * @param counter Software or hardware counter providing the count (see PulseCounter.h).
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(PulseCounter& counter);
+
+        /**
+         * @brief Process a recorded trace of samples, e.g. an encoder log on the host.
+         * @param counts Pulse counts, one per sample.
+         * @param timestamps Sample timestamps, one per sample.
+         * @param out Filtered speeds in RPM, one per sample.
+         * @param n Number of samples.
+         * @note Produces the same output as calling estimateSpeed(counts[i], timestamps[i])
+         * for each sample, and the state is carried over, so a long trace can be fed in chunks.
+         * The differentiation and scaling stage runs in a separate, vectorizable pass before
+         * the recursive filter. Chunks with repeated timestamps, or an adaptive filter table,
+         * fall back to the per-sample path.
+         */
+        void estimateSpeedBatch(const int32_t* counts, const uint32_t* timestamps, float* out, size_t n);
+
+        /**
+         * @brief Set the time without edges after which the period and M/T modes report zero speed.
+         * @param timeoutMicros Timeout in microseconds (1 s by default), whatever the timestamp rate.
+         */
+        void setPeriodTimeout(uint32_t timeoutMicros);
+
+        /**
+         * @brief Enable the fixed-period mode of estimateSpeed(int pulsesCount).
+         * @param periodMicros Period in microseconds at which estimateSpeed(int) is called
+         * (e.g. by a timer or a TickScheduler), or 0 to measure the interval again.
+         * @note The speed is then the pulse difference times a factor precomputed here:
+         * no clock read and no division per call, and no timestamp noise. The overloads
+         * taking timestamps are not affected. Define SPEEDESTIMATOR_PERIOD_CHECK to a
+         * tolerance in percent (e.g. -DSPEEDESTIMATOR_PERIOD_CHECK=10) to measure the real
+         * period anyway and count the calls outside the tolerance in periodDeviations().
+         */
+        void setFixedPeriod(uint32_t periodMicros);
+
+        /**
+         * @brief Nominal period of the fixed-period mode in microseconds (0 when disabled).
+         */
+        uint32_t fixedPeriod() const { return mFixedPeriod; }
+
+        /**
+         * @brief Fixed-period calls whose measured period was outside SPEEDESTIMATOR_PERIOD_CHECK percent.
+         * @return Always 0 when SPEEDESTIMATOR_PERIOD_CHECK is not defined.
+         */
+        uint32_t periodDeviations() const {
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+            return mPeriodDeviations;
+#else
+            return 0;
+#endif
+        }
+
+        /**
+         * @brief Measured period of the last fixed-period call in microseconds.
+         * @return Always 0 when SPEEDESTIMATOR_PERIOD_CHECK is not defined.
+         */
+        uint32_t checkedPeriod() const {
+#ifdef SPEEDESTIMATOR_PERIOD_CHECK
+            return mCheckedPeriod;
+#else
+            return 0;
+#endif
+        }
+
+#ifdef SPEEDESTIMATOR_INSTRUMENTATION
+        /**
+         * @brief Timing statistics of the calls since construction or resetStats().
+         * @note Recorded by estimateSpeed(), estimateSpeedFromPeriod() and estimateSpeedMT()
+         * (not estimateSpeedBatch()). The cycle cost excludes the clock read of the
+         * overloads without a timestamp. In fixed-period mode the interval is measured
+         * with the clock for the statistics only, and the first call after
+         * setFixedPeriod() or reset() is not recorded.
+         */
+        const SpeedEstimatorStats& stats() const { return mStats; }
+
+        /**
+         * @brief Clear the timing statistics.
+         * @param overlongMicros Interval above which a call is counted as overlong.
+         */
+        void resetStats(uint32_t overlongMicros = 20000) { mStats.reset(overlongMicros); }
+#endif
+
+        /**
+         * @brief Set the time base of the timestamps passed to the estimator.
+         * @param ticksPerSecond Timestamp ticks per second (1000000 for micros(), the default;
+         * F_CPU for AvrInputCapture). The period timeout is rescaled accordingly.
+         * @note All timestamps passed explicitly must then use this time base, so use the
+         * overloads taking the current time explicitly: the compile-time clock policy keeps
+         * working in microseconds. The sample times are converted back to microseconds for
+         * the AdaptiveFilterTable lookup and the SPEEDESTIMATOR_INSTRUMENTATION statistics.
+         */
+        void setTimestampRate(uint32_t ticksPerSecond);
+
         /**
          * @brief Reset the internal state of the estimator.
          */
         void reset();
+
+        /**
+         * @brief Replace the low-pass filter (e.g. after changing the loop period).
+         * @param filter The new filter; its state is reset.
+         */
+        void setFilter(const IIRFilter& filter);
+
+        /**
+         * @brief Access the low-pass filter.
+         */
+        IIRFilter& filter() { return mCore.filter(); }
+
+        /**
+         * @brief Enable sample-time-adaptive filtering.
+         * @param table First-order coefficients indexed by the measured deltaTime. The
+         * filter coefficients are replaced on every call, keeping the cutoff constant
+         * when the loop period jitters. Pass nullptr to disable; the filter then keeps
+         * the last coefficients until setFilter() is called.
+         * @note The table is not copied and must outlive the estimator.
+         * @note The table is first-order: a second-order filter passed to the constructor
+         * or to setFilter() is replaced by the first-order design of the table.
+         */
+        void setAdaptiveFilter(const AdaptiveFilterTable* table) { mAdaptiveTable = table; }
 };
 
+} // inline namespace SPEEDESTIMATOR_LAYOUT
+
 #endif
\ No newline at end of file
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorBank.h
+ * @brief Multi-channel speed estimator with struct-of-arrays state.
+ *
+ * Controllers driving several motors usually sample all encoders in the same
+ * loop iteration. SpeedEstimatorBank keeps the per-channel state in parallel
+ * arrays and updates all channels in one call, with one timestamp and one
+ * reciprocal of the elapsed time shared by every channel, in a tight loop the
+ * compiler can unroll and vectorize. No heap is used.
+ *
+ * The reciprocal rounds once more than the division of SpeedEstimator, so each
+ * channel differs from a SpeedEstimator with the same filter by float rounding:
+ * below 1e-6 of the largest speed of the channel.
+ */
+
+#ifndef __SPEEDESTIMATORBANK_H__
+#define __SPEEDESTIMATORBANK_H__
+
+#include <Arduino.h>
+#include "IIRFilter.h"
+#include "SpeedEstimatorCore.h"
+
+/**
+ * @class SpeedEstimatorBank
+ * @brief N speed estimators sharing one timestamp and one first-order filter design.
+ * @tparam N Number of channels.
+ *
+ * Example usage:
+ * @code
+ * SpeedEstimatorBank<4> bank;
+ * bank.configureAll(ppr, gearRatio);
+ *
+ * int32_t counts[4];
+ * // ... read the 4 encoder counts ...
+ * bank.update(counts, micros());
+ * float speed2 = bank.speed(2);
+ * @endcode
+ */
+template <uint8_t N>
+class SpeedEstimatorBank {
+    static_assert(N > 0, "A bank needs at least one channel");
+
+    private:
+        uint32_t mPrevTime; ///< Previous timestamp in microseconds, shared by all channels.
+        int32_t mPrevCounts[N]; ///< Previous number of pulses per channel.
+        float mRpmScale[N]; ///< RPM * us per pulse per channel: 60e6 / (ppr * gearRatio).
+        float mSpeedFilt[N]; ///< Filtered velocity per channel.
+        float mSpeedPrev[N]; ///< Previous raw velocity per channel.
+
+        float mB0, mB1, mA1; ///< Shared first-order filter coefficients.
+
+    public:
+        /**
+         * @brief Constructor for SpeedEstimatorBank.
+         * @param filter First-order low-pass filter shared by all channels (b2 and a2 are ignored).
+         * @note Channels must be configured with configure() or configureAll().
+         */
+        explicit SpeedEstimatorBank(const IIRFilter& filter = IIRFilter())
+            : mPrevTime(0), mB0(filter.b0()), mB1(filter.b1()), mA1(filter.a1()) {
+            for (uint8_t i = 0; i < N; i++) {
+                mRpmScale[i] = 0;
+            }
+            reset();
+        }
+
+        /**
+         * @brief Set the encoder and gear ratio of one channel.
+         * @param channel Channel index (0..N-1).
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         */
+        void configure(uint8_t channel, float ppr, float gearRatio) {
+            mRpmScale[channel] = SpeedEstimatorCore::rpmScale(ppr, gearRatio);
+        }
+
+        /**
+         * @brief Set the same encoder and gear ratio on all channels.
+         */
+        void configureAll(float ppr, float gearRatio) {
+            for (uint8_t i = 0; i < N; i++) {
+                configure(i, ppr, gearRatio);
+            }
+        }
+
+        /**
+         * @brief Update all channels from counts sampled at the same time.
+         * @param counts N pulse counts, one per channel.
+         * @param timestampMicros Time in microseconds at which the counts were read.
+         */
+        void update(const int32_t* counts, uint32_t timestampMicros) {
+            uint32_t deltaTimeMicros = timestampMicros - mPrevTime;
+            if (deltaTimeMicros == 0) {
+                // Avoid division by zero
+                return;
+            }
+            mPrevTime = timestampMicros;
+
+            // One division for the whole bank
+            const float invDeltaTime = 1.0f / (float)deltaTimeMicros;
+
+            for (uint8_t i = 0; i < N; i++) {
+                // Unsigned difference: wraps like the single-channel estimator
+                int32_t pulseDiff = (int32_t)((uint32_t)counts[i] - (uint32_t)mPrevCounts[i]);
+                mPrevCounts[i] = counts[i];
+
+                float velocity = (float)pulseDiff * mRpmScale[i] * invDeltaTime;
+                mSpeedFilt[i] = mB0 * velocity + mB1 * mSpeedPrev[i] - mA1 * mSpeedFilt[i];
+                mSpeedPrev[i] = velocity;
+            }
+        }
+
+        /**
+         * @brief Filtered speed of one channel in RPM.
+         */
+        float speed(uint8_t channel) const { return mSpeedFilt[channel]; }
+
+        /**
+         * @brief Filtered speeds of all channels in RPM (N values).
+         */
+        const float* speeds() const { return mSpeedFilt; }
+
+        /**
+         * @brief Number of channels.
+         */
+        static uint8_t size() { return N; }
+
+        /**
+         * @brief Reset the state of all channels (configuration is kept).
+         */
+        void reset() {
+            mPrevTime = 0;
+            for (uint8_t i = 0; i < N; i++) {
+                mPrevCounts[i] = 0;
+                mSpeedFilt[i] = 0;
+                mSpeedPrev[i] = 0;
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorClock.h
+ * @brief Compile-time clock policies used by SpeedEstimator to timestamp samples.
+ *
+ * A clock policy is any type with a static `uint32_t now()` member returning a
+ * free-running timestamp in microseconds that wraps at 2^32.
+ *
+ * The policy used by SpeedEstimator::estimateSpeed(int pulsesCount) is selected
+ * at compile time by defining SPEEDESTIMATOR_CLOCK in the build flags, so the
+ * library and the sketch are compiled with the same policy, for example:
+ * @code
+ * // platformio.ini: build_flags = -DSPEEDESTIMATOR_CLOCK=Esp32CycleClock
+ * @endcode
+ *
+ * @note Timestamps captured elsewhere (e.g. in the encoder ISR, together with the
+ * pulse count) can be passed directly to SpeedEstimator::estimateSpeed(int, uint32_t),
+ * bypassing the clock policy entirely.
+ */
+
+#ifndef __SPEEDESTIMATORCLOCK_H__
+#define __SPEEDESTIMATORCLOCK_H__
+
+#include <Arduino.h>
+
+#if defined(ESP32) && defined(__XTENSA__)
+#include <xtensa/core-macros.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @struct ArduinoMicrosClock
+ * @brief Clock policy based on the Arduino micros() function (default).
+ */
+struct ArduinoMicrosClock {
+    static inline uint32_t now() { return (uint32_t)micros(); }
+};
+
+/**
+ * @struct CycleCounterClock
+ * @brief Clock policy extending a 32-bit CPU cycle counter into microseconds.
+ * @tparam Cycles Type with a static `uint32_t read()` returning the cycle counter.
+ * @tparam CyclesPerMicro CPU cycles per microsecond.
+ *
+ * Reading a cycle counter is usually a single instruction, much cheaper than
+ * micros(). The cycles left over from each call are carried to the next one, so
+ * the timestamp does not drift. now() must be called at least once per counter
+ * wrap (2^32 cycles, about 17 s at 240 MHz).
+ * @note Not reentrant: call it from a single context (e.g. the control loop).
+ */
+template <class Cycles, uint32_t CyclesPerMicro>
+struct CycleCounterClock {
+    static inline uint32_t now() {
+        static uint32_t lastCycles = 0;
+        static uint32_t remainderCycles = 0;
+        static uint32_t timeMicros = 0;
+
+        uint32_t cycles = Cycles::read();
+        uint32_t elapsed = (cycles - lastCycles) + remainderCycles;
+        lastCycles = cycles;
+        timeMicros += elapsed / CyclesPerMicro;
+        remainderCycles = elapsed % CyclesPerMicro;
+        return timeMicros;
+    }
+};
+
+#if defined(ESP32) && defined(__XTENSA__)
+/**
+ * @struct Esp32CCount
+ * @brief Xtensa ESP32 CPU cycle counter (CCOUNT register: ESP32, ESP32-S2, ESP32-S3).
+ */
+struct Esp32CCount {
+    static inline uint32_t read() { return XTHAL_GET_CCOUNT(); }
+};
+
+/// Clock policy based on the ESP32 CPU cycle counter.
+typedef CycleCounterClock<Esp32CCount, F_CPU / 1000000UL> Esp32CycleClock;
+#elif defined(ESP32)
+/// RISC-V ESP32 (ESP32-C3, C6, H2): no CCOUNT register, the policy falls back to micros().
+typedef ArduinoMicrosClock Esp32CycleClock;
+#endif
+
+/**
+ * @struct SpeedEstimatorCycleCounter
+ * @brief CPU cycle counter used by the optional instrumentation (SpeedEstimatorStats.h).
+ *
+ * Cycle-exact on Xtensa ESP32 (CCOUNT) and on x86 hosts (TSC, reference cycles). Elsewhere,
+ * including the RISC-V ESP32 variants, it is derived from micros(): on a 16 MHz AVR the
+ * resolution is 64 cycles (4 us) and the micros() call itself is included.
+ */
+struct SpeedEstimatorCycleCounter {
+    static inline uint32_t now() {
+#if defined(ESP32) && defined(__XTENSA__)
+        return XTHAL_GET_CCOUNT();
+#elif defined(__x86_64__) || defined(__i386__)
+        return (uint32_t)__rdtsc();
+#elif defined(F_CPU)
+        return (uint32_t)micros() * (uint32_t)(F_CPU / 1000000UL);
+#else
+        return (uint32_t)micros();
+#endif
+    }
+};
+
+#ifndef SPEEDESTIMATOR_CLOCK
+#define SPEEDESTIMATOR_CLOCK ArduinoMicrosClock
+#endif
+
+/// Clock policy selected at compile time for SpeedEstimator.
+typedef SPEEDESTIMATOR_CLOCK SpeedEstimatorClock;
+
+#endif
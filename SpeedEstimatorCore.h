@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorCore.h
+ * @brief Pulse differentiation, counts-to-RPM scaling and filter state shared by the estimators.
+ *
+ * SpeedEstimator (scale and period set at run time) and SpeedEstimatorT (set at
+ * compile time) both run on this core, so the counter wrap handling, the RPM scale
+ * and the filter stage are written once and give the same results in both. The
+ * tracking estimators use the sample bookkeeping and the RPM scale without the filter.
+ */
+
+#ifndef __SPEEDESTIMATORCORE_H__
+#define __SPEEDESTIMATORCORE_H__
+
+#include <Arduino.h>
+#include "IIRFilter.h"
+
+/**
+ * @class SpeedEstimatorSample
+ * @brief Previous count and timestamp, with the wrap-safe differences to them.
+ *
+ * Shared by SpeedEstimatorCore and the tracking estimators (TrackingEstimator.h).
+ */
+class SpeedEstimatorSample {
+    private:
+        uint32_t mPrevTime; ///< Previous timestamp in microseconds (or timestamp ticks).
+        int mPrevNumPulses; ///< Previous number of pulses.
+
+    public:
+        SpeedEstimatorSample() : mPrevTime(0), mPrevNumPulses(0) {}
+
+        /**
+         * @brief Signed pulse difference since the previous count, which is replaced.
+         * @note Computed in unsigned arithmetic, where wrapping is well defined, so a
+         * counter overflow between both counts gives the right difference.
+         */
+        int pulseDiff(int pulsesCount) {
+            int diff = (int)((unsigned int)pulsesCount - (unsigned int)mPrevNumPulses);
+            mPrevNumPulses = pulsesCount;
+            return diff;
+        }
+
+        /**
+         * @brief Time since the previous timestamp, which is replaced unless the time is the same.
+         * @return 0 for a repeated timestamp (no new sample). Wraps correctly.
+         */
+        uint32_t advance(uint32_t timestamp) {
+            uint32_t deltaTime = timestamp - mPrevTime;
+            if (deltaTime != 0) {
+                mPrevTime = timestamp;
+            }
+            return deltaTime;
+        }
+
+        int prevNumPulses() const { return mPrevNumPulses; } ///< Previous number of pulses.
+        uint32_t prevTime() const { return mPrevTime; } ///< Previous timestamp.
+
+        /**
+         * @brief Set the previous sample, e.g. after processing a block outside the core.
+         */
+        void setPrevious(int pulsesCount, uint32_t timestamp) {
+            mPrevNumPulses = pulsesCount;
+            mPrevTime = timestamp;
+        }
+
+        /**
+         * @brief Forget the previous sample.
+         */
+        void reset() {
+            mPrevTime = 0;
+            mPrevNumPulses = 0;
+        }
+};
+
+/**
+ * @class SpeedEstimatorCore
+ * @brief Previous sample, low-pass filter and the arithmetic between them.
+ */
+class SpeedEstimatorCore : public SpeedEstimatorSample {
+    private:
+        IIRFilter mFilter; ///< Low-pass filter applied to the raw velocity.
+
+    public:
+        /**
+         * @brief Constructor for SpeedEstimatorCore.
+         * @param filter Low-pass filter applied to the speed; its state is reset.
+         */
+        explicit SpeedEstimatorCore(const IIRFilter& filter) : mFilter(filter) {
+            mFilter.reset();
+        }
+
+        /**
+         * @brief RPM * tick per pulse: 60 * 1e6 / (ppr * gearRatio) for microsecond timestamps.
+         */
+        static constexpr float rpmScale(float ppr, float gearRatio) { return 60.0e6f / (ppr * gearRatio); }
+
+        /**
+         * @brief Velocity in RPM of pulseDiff pulses over deltaTime (single division).
+         */
+        static float velocity(int pulseDiff, float rpmScale, uint32_t deltaTime) {
+            return ((float)pulseDiff) * rpmScale / ((float)deltaTime);
+        }
+
+        /**
+         * @brief Filter a raw velocity.
+         */
+        float update(float velocity) { return mFilter.update(velocity); }
+
+        /**
+         * @brief Last filtered speed.
+         */
+        float output() const { return mFilter.output(); }
+
+        /**
+         * @brief Access the low-pass filter.
+         */
+        IIRFilter& filter() { return mFilter; }
+
+        /**
+         * @brief Replace the low-pass filter; its state is reset.
+         */
+        void setFilter(const IIRFilter& filter) {
+            mFilter = filter;
+            mFilter.reset();
+        }
+
+        /**
+         * @brief Forget the previous sample and the filter state.
+         */
+        void reset() {
+            SpeedEstimatorSample::reset();
+            mFilter.reset();
+        }
+};
+
+#endif
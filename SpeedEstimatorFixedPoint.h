@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorFixedPoint.h
+ * @brief Q16.16 helpers shared by the fixed-point estimators (SpeedEstimatorQ, AlphaBetaEstimatorQ).
+ *
+ * Every product is evaluated with 32-bit intermediates only, so no 64-bit
+ * arithmetic is pulled in on 8-bit targets. Included by the implementation
+ * files only.
+ */
+
+#ifndef __SPEEDESTIMATORFIXEDPOINT_H__
+#define __SPEEDESTIMATORFIXEDPOINT_H__
+
+#include <stdint.h>
+
+/**
+ * @brief Rounded (x * c) / 2^16 using only 32-bit intermediates.
+ *
+ * x is split as hi * 2^16 + lo (hi signed, lo in [0, 65535]) so that neither
+ * partial product overflows 32 bits.
+ */
+static inline int32_t mulQ16(int32_t x, uint16_t c) {
+    int32_t hi = (x >> 16) * (int32_t)c;
+    uint32_t lo = ((uint32_t)(x & 0xFFFF) * c + 0x8000UL) >> 16;
+    return hi + (int32_t)lo;
+}
+
+/**
+ * @brief a + b, saturated to the int32_t range.
+ */
+static inline int32_t addSaturated(int32_t a, int32_t b) {
+    int32_t sum;
+    if (__builtin_add_overflow(a, b, &sum)) {
+        return (b > 0) ? INT32_MAX : INT32_MIN;
+    }
+    return sum;
+}
+
+#endif
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorQ.cpp
+ * @brief Implementation of the SpeedEstimatorQ class.
+ */
+
+#include "SpeedEstimatorQ.h"
+#include "SpeedEstimatorCore.h"
+#include "SpeedEstimatorFixedPoint.h"
+
+/**
+ * @brief Rounded (v * c) / 2^shift as Q16.16, saturated to INT32_MAX, using only
+ * 32-bit intermediates.
+ *
+ * v has shift fractional bits (0..16); the 48-bit product is split as
+ * hi * 2^16 + lo, as in mulQ16().
+ */
+static inline uint32_t mulToQ16(uint32_t v, uint16_t c, uint8_t shift) {
+    uint32_t hi = (v >> 16) * c;
+    uint32_t lo = (v & 0xFFFF) * c;
+    uint8_t up = 16 - shift;
+    if (hi > (0x7FFFFFFFUL >> up)) {
+        return 0x7FFFFFFFUL;
+    }
+    uint32_t high = hi << up;
+    uint32_t low = (shift == 0) ? lo : (lo + (1UL << (shift - 1))) >> shift;
+    return (low > 0x7FFFFFFFUL - high) ? 0x7FFFFFFFUL : high + low;
+}
+
+/**
+ * @brief Convert a coefficient in [0, 1) to Q0.16.
+ */
+static uint16_t toQ16Coefficient(float coefficient) {
+    float scaled = coefficient * 65536.0f + 0.5f;
+    if (scaled <= 0) {
+        return 0;
+    }
+    return (scaled >= 65535.0f) ? 65535 : (uint16_t)scaled;
+}
+
+SpeedEstimatorQ::SpeedEstimatorQ(float ppr, float gearRatio, const IIRFilter& filter)
+    : mPrevTime(0), mPrevNumPulses(0), mSpeedFilt(0), mSpeedPrevB(0), mScale(0), mScaleShift(16),
+      mCoeffA(toQ16Coefficient(-filter.a1())), mCoeffB(toQ16Coefficient(filter.b0())) {
+    // RPM * us per pulse: (1 pulse / 1 us) / ppr / gearRatio * 60 s/min * 1e6 us/s
+    float scale = SpeedEstimatorCore::rpmScale(ppr, gearRatio);
+
+    // Keep as many fractional bits as fit in 32 bits
+    while (mScaleShift > 0 && scale * (float)(1UL << mScaleShift) >= 4294967296.0f) {
+        mScaleShift--;
+    }
+    float scaled = scale * (float)(1UL << mScaleShift);
+    mScale = (scaled >= 4294967296.0f) ? 0xFFFFFFFFUL : (uint32_t)(scaled + 0.5f);
+}
+
+int32_t SpeedEstimatorQ::estimateSpeedQ(int pulsesCount) {
+    return estimateSpeedQ(pulsesCount, SpeedEstimatorClock::now());
+}
+
+int32_t SpeedEstimatorQ::estimateSpeedQ(int pulsesCount, uint32_t timestampMicros) {
+    // Handle timestamp overflow: unsigned arithmetic automatically wraps correctly
+    uint32_t deltaTimeMicros = timestampMicros - mPrevTime;
+
+    if (deltaTimeMicros == 0) {
+        // Avoid division by zero
+        return mSpeedFilt;
+    }
+
+    // Handle pulse counter overflow by calculating the signed difference
+    int pulseDiff = (int)((unsigned int)pulsesCount - (unsigned int)mPrevNumPulses);
+
+    mPrevNumPulses = pulsesCount;
+    mPrevTime = timestampMicros;
+
+    // RPM contributed by one pulse over this interval (mScaleShift fractional bits)
+    uint32_t rpmPerPulse = mScale / deltaTimeMicros;
+
+    // Velocity magnitude in RPM (mScaleShift fractional bits). It is not limited to
+    // the Q16.16 range: only its product with b has to fit, so a short burst above
+    // 32767 RPM is filtered as in the float version
+    uint32_t magnitude = (pulseDiff < 0) ? 0U - (uint32_t)pulseDiff : (uint32_t)pulseDiff;
+    uint32_t velocity;
+    if (__builtin_mul_overflow(magnitude, rpmPerPulse, &velocity)) {
+        velocity = 0xFFFFFFFFUL;
+    }
+
+    // First-order low-pass filter, saturated:
+    // filt = a * filt + b * velocity + b * prevVelocity
+    int32_t velocityB = (int32_t)mulToQ16(velocity, mCoeffB, mScaleShift);
+    if (pulseDiff < 0) {
+        velocityB = -velocityB;
+    }
+    mSpeedFilt = addSaturated(addSaturated(mulQ16(mSpeedFilt, mCoeffA), velocityB), mSpeedPrevB);
+    mSpeedPrevB = velocityB;
+
+    return mSpeedFilt;
+}
+
+void SpeedEstimatorQ::reset() {
+    mPrevTime = 0;
+    mPrevNumPulses = 0;
+    mSpeedFilt = 0;
+    mSpeedPrevB = 0;
+}
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorQ.h
+ * @brief Integer (fixed-point) variant of SpeedEstimator for MCUs without an FPU.
+ *
+ * SpeedEstimatorQ implements the same estimation as SpeedEstimator (pulse
+ * difference over elapsed time, conversion to RPM and the same first-order
+ * low-pass filter) using only 32-bit integer arithmetic:
+ * - The counts-to-RPM factor 60e6 / (ppr * gearRatio) is folded at construction
+ *   into a single unsigned fixed-point scale, so each call performs one 32-bit
+ *   division (scale / deltaTime) instead of two float divisions.
+ * - Speeds are kept in Q16.16 (signed 16-bit integer RPM part, 16-bit fraction),
+ *   so the output range is about +/-32767 RPM with a resolution of 1.5e-5 RPM.
+ *   Filtered speeds outside that range saturate. The raw velocity of a single
+ *   interval may exceed it, as long as b0 times it fits.
+ * - Filter coefficients are Q0.16 and products are evaluated with 32-bit
+ *   intermediates only (no 64-bit arithmetic on 8-bit targets).
+ *
+ * Tolerance with respect to SpeedEstimator (float), within the range above:
+ *
+ *     |fixed - float| <= eps * F + 2^-15 / (1 + a1) RPM
+ *     eps = deltaTime / (scale * 2^scaleShift()) + 2^-16 * (1 / b0 + 1 / (1 + a1))
+ *
+ * where scale = 60e6 / (ppr * gearRatio), deltaTime is the longest interval, and F
+ * is the float filter applied to the magnitude of the raw velocity (the same as
+ * |float| while the direction does not change). The first term of eps is the
+ * truncation of the RPM per pulse, the second one the rounding of the
+ * coefficients, and the constant the rounding of each filter step. For the
+ * default filter, ppr 22 and gear ratio 9.3 at 10 ms, eps is about 1.7e-4 and the
+ * constant 1.1e-4 RPM. Near a direction change the error is relative to F, not to
+ * the output, which goes through zero.
+ *
+ * Example usage:
+ * @code
+ * SpeedEstimatorQ speedEstimator(ppr, gearRatio);
+ * int32_t speedQ16 = speedEstimator.estimateSpeedQ(currentPulses); // RPM in Q16.16
+ * float speed = SpeedEstimatorQ::toFloat(speedQ16); // Only where a float is needed
+ * @endcode
+ */
+
+#ifndef __SPEEDESTIMATORQ_H__
+#define __SPEEDESTIMATORQ_H__
+
+#include <Arduino.h>
+#include "SpeedEstimatorClock.h"
+#include "IIRFilter.h"
+
+/**
+ * @class SpeedEstimatorQ
+ * @brief Fixed-point motor speed estimator returning RPM in Q16.16.
+ * @note This class is independent of the data source for position readings.
+ * This implementation assumes that estimateSpeedQ(int pulsesCount) is called periodically.
+ */
+class SpeedEstimatorQ {
+    private:
+        uint32_t mPrevTime; ///< Previous timestamp in microseconds.
+        int mPrevNumPulses; ///< Previous number of pulses.
+        int32_t mSpeedFilt; ///< Filtered velocity (RPM, Q16.16).
+        int32_t mSpeedPrevB; ///< Previous velocity already weighted by mCoeffB (RPM, Q16.16).
+
+        uint32_t mScale; ///< RPM * us per pulse, fixed-point with mScaleShift fractional bits.
+        uint8_t mScaleShift; ///< Fractional bits of mScale (0..16).
+
+        uint16_t mCoeffA; ///< Filter feedback coefficient (Q0.16).
+        uint16_t mCoeffB; ///< Filter input coefficient (Q0.16).
+
+    public:
+        /**
+         * @brief Constructor for SpeedEstimatorQ.
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         * @param filter First-order low-pass filter applied to the speed (b0 and -a1 are
+         * converted to Q0.16; b2 and a2 are ignored and b1 is taken equal to b0).
+         * @note Floats are only used here to compute the fixed-point constants.
+         */
+        SpeedEstimatorQ(float ppr, float gearRatio, const IIRFilter& filter = IIRFilter());
+
+        /**
+         * @brief Calculate the speed of the motor.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM, Q16.16.
+         */
+        int32_t estimateSpeedQ(int pulsesCount);
+
+        /**
+         * @brief Calculate the speed of the motor from a timestamped sample.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @param timestampMicros Time in microseconds at which pulsesCount was read.
+         * @return The calculated speed in RPM, Q16.16.
+         */
+        int32_t estimateSpeedQ(int pulsesCount, uint32_t timestampMicros);
+
+        /**
+         * @brief Drop-in replacement for SpeedEstimator::estimateSpeed().
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(int pulsesCount) { return toFloat(estimateSpeedQ(pulsesCount)); }
+
+        /**
+         * @brief Reset the internal state of the estimator.
+         */
+        void reset();
+
+        /**
+         * @brief Fractional bits of the internal counts-to-RPM scale.
+         */
+        uint8_t scaleShift() const { return mScaleShift; }
+
+        /**
+         * @brief Convert a Q16.16 value to float.
+         */
+        static float toFloat(int32_t valueQ16) { return (float)valueQ16 * (1.0f / 65536.0f); }
+};
+
+#endif
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorStats.h
+ * @brief Timing statistics of the calls to SpeedEstimator (optional instrumentation).
+ *
+ * The filter is designed for one sample period, so irregular calls degrade the
+ * estimate. Building with SPEEDESTIMATOR_INSTRUMENTATION defined (in the build flags,
+ * for the library and the sketch alike) makes SpeedEstimator record, for each call:
+ * the interval since the previous sample (min/max/mean and a log2 histogram), the
+ * calls with a zero or overlong interval, and the CPU cycles spent in the call.
+ * Without the flag, nothing is recorded and SpeedEstimator has no stats member. A
+ * library and a sketch built with different flags fail to link (see SpeedEstimator.h).
+ *
+ * Example usage:
+ * @code
+ * // platformio.ini: build_flags = -DSPEEDESTIMATOR_INSTRUMENTATION
+ * const SpeedEstimatorStats& stats = speedEstimator.stats();
+ * Serial.println(stats.meanDeltaTime());
+ * @endcode
+ */
+
+#ifndef __SPEEDESTIMATORSTATS_H__
+#define __SPEEDESTIMATORSTATS_H__
+
+#include <stdint.h>
+
+/**
+ * @struct SpeedEstimatorStats
+ * @brief Call interval and cost statistics.
+ */
+struct SpeedEstimatorStats {
+    static const uint8_t HISTOGRAM_BINS = 16; ///< Bin k counts intervals in [2^k, 2^(k+1)) us; the last one is open.
+
+    uint32_t calls; ///< Calls recorded.
+    uint32_t zeroDeltaTimeCalls; ///< Calls with the same timestamp as the previous sample (ignored by the estimator).
+    uint32_t overlongDeltaTimeCalls; ///< Calls with an interval above overlongThreshold.
+    uint32_t overlongThreshold; ///< Interval in microseconds above which a call is overlong.
+    uint32_t minDeltaTime; ///< Shortest non-zero interval in microseconds.
+    uint32_t maxDeltaTime; ///< Longest interval in microseconds.
+    uint64_t sumDeltaTime; ///< Sum of the non-zero intervals in microseconds.
+    uint32_t histogram[HISTOGRAM_BINS]; ///< Non-zero intervals per power of two.
+    uint32_t minCycles; ///< Cheapest call in CPU cycles (see SpeedEstimatorCycleCounter).
+    uint32_t maxCycles; ///< Most expensive call in CPU cycles.
+    uint64_t sumCycles; ///< Sum of the call costs in CPU cycles.
+
+    explicit SpeedEstimatorStats(uint32_t overlongMicros = 20000) { reset(overlongMicros); }
+
+    /**
+     * @brief Clear the statistics.
+     * @param overlongMicros Interval above which a call is overlong (twice the default 10 ms period).
+     */
+    void reset(uint32_t overlongMicros = 20000) {
+        calls = 0;
+        zeroDeltaTimeCalls = 0;
+        overlongDeltaTimeCalls = 0;
+        overlongThreshold = overlongMicros;
+        minDeltaTime = 0xFFFFFFFFUL;
+        maxDeltaTime = 0;
+        sumDeltaTime = 0;
+        for (uint8_t i = 0; i < HISTOGRAM_BINS; i++) {
+            histogram[i] = 0;
+        }
+        minCycles = 0xFFFFFFFFUL;
+        maxCycles = 0;
+        sumCycles = 0;
+    }
+
+    /**
+     * @brief Record one call.
+     * @param deltaTime Interval since the previous sample in microseconds.
+     * @param cycles Cost of the call in CPU cycles.
+     */
+    void record(uint32_t deltaTime, uint32_t cycles) {
+        calls++;
+        sumCycles += cycles;
+        if (cycles < minCycles) {
+            minCycles = cycles;
+        }
+        if (cycles > maxCycles) {
+            maxCycles = cycles;
+        }
+
+        if (deltaTime == 0) {
+            zeroDeltaTimeCalls++;
+            return;
+        }
+        sumDeltaTime += deltaTime;
+        if (deltaTime < minDeltaTime) {
+            minDeltaTime = deltaTime;
+        }
+        if (deltaTime > maxDeltaTime) {
+            maxDeltaTime = deltaTime;
+        }
+        if (deltaTime > overlongThreshold) {
+            overlongDeltaTimeCalls++;
+        }
+        uint8_t bin = 0;
+        for (uint32_t v = deltaTime >> 1; v != 0 && bin < HISTOGRAM_BINS - 1; v >>= 1) {
+            bin++;
+        }
+        histogram[bin]++;
+    }
+
+    /**
+     * @brief Mean non-zero interval in microseconds (0 before the first one).
+     */
+    float meanDeltaTime() const {
+        uint32_t n = calls - zeroDeltaTimeCalls;
+        return (n != 0) ? (float)sumDeltaTime / (float)n : 0.0f;
+    }
+
+    /**
+     * @brief Mean cost of a call in CPU cycles (0 before the first call).
+     */
+    float meanCycles() const { return (calls != 0) ? (float)sumCycles / (float)calls : 0.0f; }
+};
+
+#endif
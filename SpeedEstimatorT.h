@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SpeedEstimatorT.h
+ * @brief Compile-time specialized speed estimator for encoders known at build time.
+ *
+ * When the encoder resolution, the gear ratio and the sample period are known at
+ * build time, the whole counts-to-RPM conversion collapses into one constant
+ * multiplier computed by the compiler, so no division is left on the hot path.
+ *
+ * It runs on the same core as SpeedEstimator (SpeedEstimatorCore.h): called at its
+ * period, it returns the same speeds as SpeedEstimator in fixed-period mode.
+ */
+
+#ifndef __SPEEDESTIMATORT_H__
+#define __SPEEDESTIMATORT_H__
+
+#include <Arduino.h>
+#include "IIRFilter.h"
+#include "SpeedEstimatorCore.h"
+
+/**
+ * @class SpeedEstimatorT
+ * @brief Speed estimator with encoder, gear ratio and sample period fixed at compile time.
+ * @tparam PPR Pulses per revolution of the encoder.
+ * @tparam GearNum Numerator of the gear ratio (e.g. 93 for 9.3:1).
+ * @tparam GearDen Denominator of the gear ratio (e.g. 10 for 9.3:1).
+ * @tparam SampleUs Nominal period in microseconds between calls to estimateSpeed(int).
+ *
+ * Example usage:
+ * @code
+ * SpeedEstimatorT<22, 93, 10, 10000> speedEstimator; // 22 PPR, 9.3:1 gear, 10 ms loop
+ * float speed = speedEstimator.estimateSpeed(currentPulses);
+ * @endcode
+ */
+template <unsigned long PPR, unsigned long GearNum, unsigned long GearDen, unsigned long SampleUs>
+class SpeedEstimatorT {
+    static_assert(PPR > 0, "PPR must be greater than zero");
+    static_assert(GearNum > 0 && GearDen > 0, "Gear ratio terms must be greater than zero");
+    static_assert(SampleUs > 0, "Sample period must be greater than zero");
+    static_assert(SampleUs <= 10000000UL, "Sample period must not exceed 10 s");
+
+    public:
+        /// RPM * us per pulse: 60e6 / (PPR * GearNum / GearDen).
+        static constexpr float kRpmScale = SpeedEstimatorCore::rpmScale((float)PPR, (float)GearNum / (float)GearDen);
+
+        /// RPM per pulse counted over one nominal sample period.
+        static constexpr float kCountsToRpm = kRpmScale / (float)SampleUs;
+
+    private:
+        SpeedEstimatorCore mCore; ///< Previous sample and low-pass filter, shared with SpeedEstimator.
+
+    public:
+        /**
+         * @brief Constructor for SpeedEstimatorT.
+         * @param filter Low-pass filter applied to the speed, typically designed for
+         * SampleUs, e.g. IIRFilter::butterworth1(cutoffHz, SampleUs * 1e-6f).
+         */
+        explicit SpeedEstimatorT(const IIRFilter& filter = IIRFilter()) : mCore(filter) {}
+
+        /**
+         * @brief Calculate the speed of the motor in RPM, assuming a call every SampleUs.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         * @note No clock is read and no division is performed. Call it at the
+         * configured period (e.g. from a timer) for the result to be accurate.
+         */
+        float estimateSpeed(int pulsesCount) {
+            return mCore.update((float)mCore.pulseDiff(pulsesCount) * kCountsToRpm);
+        }
+
+        /**
+         * @brief Calculate the speed of the motor in RPM from a timestamped sample.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @param timestampMicros Time in microseconds at which pulsesCount was read.
+         * @return The calculated speed in RPM.
+         * @note Uses the measured interval (one division) instead of SampleUs.
+         */
+        float estimateSpeed(int pulsesCount, uint32_t timestampMicros) {
+            uint32_t deltaTimeMicros = mCore.advance(timestampMicros);
+            if (deltaTimeMicros == 0) {
+                // Avoid division by zero
+                return mCore.output();
+            }
+            return mCore.update(SpeedEstimatorCore::velocity(mCore.pulseDiff(pulsesCount), kRpmScale, deltaTimeMicros));
+        }
+
+        /**
+         * @brief Reset the internal state of the estimator.
+         */
+        void reset() { mCore.reset(); }
+
+        /**
+         * @brief Access the low-pass filter.
+         */
+        IIRFilter& filter() { return mCore.filter(); }
+};
+
+template <unsigned long PPR, unsigned long GearNum, unsigned long GearDen, unsigned long SampleUs>
+constexpr float SpeedEstimatorT<PPR, GearNum, GearDen, SampleUs>::kRpmScale;
+
+template <unsigned long PPR, unsigned long GearNum, unsigned long GearDen, unsigned long SampleUs>
+constexpr float SpeedEstimatorT<PPR, GearNum, GearDen, SampleUs>::kCountsToRpm;
+
+#endif
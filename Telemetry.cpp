@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file Telemetry.cpp
+ * @brief Implementation of the telemetry frames.
+ */
+
+#include "Telemetry.h"
+#include <string.h>
+
+const uint8_t TelemetryFrame::PAYLOAD_SIZE;
+const uint8_t TelemetryFrame::RAW_SIZE;
+const uint8_t TelemetryFrame::FRAME_SIZE;
+
+static void putUint32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t getUint32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void putFloat(uint8_t* p, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putUint32(p, bits);
+}
+
+static float getFloat(const uint8_t* p) {
+    uint32_t bits = getUint32(p);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint16_t TelemetryFrame::crc16(const uint8_t* data, uint8_t length) {
+    uint16_t crc = 0xFFFF;
+    for (uint8_t i = 0; i < length; i++) {
+        // Byte-wise update of the 0x1021 polynomial: four shifts instead of eight bit steps
+        uint8_t x = (uint8_t)(crc >> 8) ^ data[i];
+        x ^= x >> 4;
+        crc = (uint16_t)((crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ x);
+    }
+    return crc;
+}
+
+uint8_t TelemetryFrame::encode(const TelemetrySample& sample, uint8_t sequence, uint8_t* frame) {
+    uint8_t raw[RAW_SIZE];
+    raw[0] = sequence;
+    putUint32(&raw[1], sample.timestamp);
+    putUint32(&raw[5], (uint32_t)sample.count);
+    putFloat(&raw[9], sample.rawSpeed);
+    putFloat(&raw[13], sample.speed);
+    uint16_t crc = crc16(raw, PAYLOAD_SIZE);
+    raw[17] = (uint8_t)crc;
+    raw[18] = (uint8_t)(crc >> 8);
+
+    // COBS: each zero is replaced by the distance to the next zero (or to the end),
+    // the first distance is stored in the leading overhead byte
+    uint8_t codeIndex = 0;
+    uint8_t out = 1;
+    uint8_t code = 1;
+    for (uint8_t i = 0; i < RAW_SIZE; i++) {
+        if (raw[i] == 0) {
+            frame[codeIndex] = code;
+            codeIndex = out++;
+            code = 1;
+        } else {
+            frame[out++] = raw[i];
+            code++;
+        }
+    }
+    frame[codeIndex] = code;
+    frame[out++] = 0;
+    return out;
+}
+
+bool TelemetryFrame::decode(const uint8_t* frame, uint8_t length, TelemetrySample& sample, uint8_t& sequence) {
+    if (length > 0 && frame[length - 1] == 0) {
+        length--;
+    }
+    if (length != RAW_SIZE + 1) {
+        return false;
+    }
+
+    uint8_t raw[RAW_SIZE];
+    uint8_t out = 0;
+    uint8_t i = 0;
+    while (i < length) {
+        uint8_t code = frame[i++];
+        if (code == 0 || i + code - 1 > length) {
+            return false;
+        }
+        for (uint8_t j = 1; j < code; j++) {
+            if (frame[i] == 0 || out >= RAW_SIZE) {
+                return false;
+            }
+            raw[out++] = frame[i++];
+        }
+        // A code below 255 stands for a zero, except at the end of the frame
+        if (i < length) {
+            if (out >= RAW_SIZE) {
+                return false;
+            }
+            raw[out++] = 0;
+        }
+    }
+    if (out != RAW_SIZE) {
+        return false;
+    }
+
+    uint16_t crc = (uint16_t)raw[17] | ((uint16_t)raw[18] << 8);
+    if (crc != crc16(raw, PAYLOAD_SIZE)) {
+        return false;
+    }
+
+    sequence = raw[0];
+    sample.timestamp = getUint32(&raw[1]);
+    sample.count = (int32_t)getUint32(&raw[5]);
+    sample.rawSpeed = getFloat(&raw[9]);
+    sample.speed = getFloat(&raw[13]);
+    return true;
+}
+
+TelemetryDecoder::TelemetryDecoder() {
+    reset();
+}
+
+bool TelemetryDecoder::push(uint8_t byte) {
+    if (byte != 0) {
+        if (mLength < sizeof(mBuffer)) {
+            mBuffer[mLength++] = byte;
+        } else {
+            mOverflow = true;
+        }
+        return false;
+    }
+
+    // Delimiter: a chunk before the first one may be the tail of a frame, not an error
+    bool valid = false;
+    if (mLength > 0) {
+        TelemetrySample sample;
+        uint8_t sequence;
+        valid = !mOverflow && TelemetryFrame::decode(mBuffer, mLength, sample, sequence);
+        if (valid) {
+            if (mHasSequence) {
+                mLost += (uint8_t)(sequence - mSequence - 1);
+            }
+            mSample = sample;
+            mSequence = sequence;
+            mHasSequence = true;
+            mFrames++;
+        } else if (mSynchronized) {
+            mErrors++;
+        }
+    }
+    mSynchronized = true;
+    mLength = 0;
+    mOverflow = false;
+    return valid;
+}
+
+void TelemetryDecoder::reset() {
+    mLength = 0;
+    mOverflow = false;
+    mSynchronized = false;
+    mSample.timestamp = 0;
+    mSample.count = 0;
+    mSample.rawSpeed = 0;
+    mSample.speed = 0;
+    mSequence = 0;
+    mHasSequence = false;
+    mFrames = 0;
+    mErrors = 0;
+    mLost = 0;
+}
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file TelemetryBuffer.h
+ * @brief Lock-free ring buffer decoupling telemetry from the control loop.
+ *
+ * Serial.write() blocks when the UART transmit buffer is full, which stretches the
+ * sampling period the speed filter relies on. With this buffer the writer (the
+ * control loop or a sampling ISR) only copies the sample into a slot in constant
+ * time; the frames are encoded and sent later, when the UART has room: from loop()
+ * with drain(), or byte by byte from the TX-empty interrupt with nextByte(). When
+ * the buffer is full the sample is dropped and counted, never waited for.
+ *
+ * The sequence number is assigned when a sample is pushed, so dropped samples also
+ * show up as lost frames in TelemetryDecoder and decode_telemetry.py.
+ *
+ * There must be a single writer and a single reader. Each index is written by one
+ * side only, and single-byte accesses are atomic on AVR, so no interrupt is disabled.
+ */
+
+#ifndef __TELEMETRYBUFFER_H__
+#define __TELEMETRYBUFFER_H__
+
+#include <Arduino.h>
+#include "Telemetry.h"
+
+#if defined(__AVR__)
+#define TELEMETRYBUFFER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define TELEMETRYBUFFER_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/**
+ * @class TelemetryBuffer
+ * @brief Single-producer, single-consumer queue of telemetry samples.
+ * @tparam Capacity Number of samples (power of two, at most 128). Each takes 17 bytes.
+ *
+ * Example usage:
+ * @code
+ * TelemetryBuffer<16> telemetry;
+ *
+ * void loop() {
+ *     if (sampleDue) {
+ *         float speed = speedEstimator.estimateSpeed(encoder);
+ *         telemetry.push(TelemetrySample{now, count, speedEstimator.filter().input(), speed});
+ *     }
+ *     telemetry.drain(Serial); // Sends what fits in the TX buffer, never blocks
+ * }
+ * @endcode
+ */
+template <uint8_t Capacity>
+class TelemetryBuffer {
+    static_assert(Capacity > 0 && Capacity <= 128 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two, at most 128");
+
+    private:
+        static const uint8_t MASK = Capacity - 1;
+
+        TelemetrySample mSamples[Capacity]; ///< Queued samples.
+        uint8_t mSequences[Capacity]; ///< Sequence number of each queued sample.
+        volatile uint8_t mHead; ///< Free-running write index (writer side only).
+        volatile uint8_t mTail; ///< Free-running read index (reader side only).
+        uint8_t mNextSequence; ///< Sequence number of the next pushed sample (writer side).
+        volatile uint32_t mDropped; ///< Samples dropped because the buffer was full (writer side).
+
+        uint8_t mFrame[TelemetryFrame::FRAME_SIZE]; ///< Frame being sent (reader side).
+        uint8_t mFrameLength; ///< Bytes in mFrame.
+        uint8_t mFramePosition; ///< Bytes of mFrame already sent.
+
+        /**
+         * @brief Encode the next queued sample into mFrame, once the previous frame is sent.
+         * @return false if nothing is left to send.
+         */
+        bool loadFrame() {
+            if (mFramePosition < mFrameLength) {
+                return true;
+            }
+            uint8_t tail = mTail;
+            if (tail == mHead) {
+                return false;
+            }
+            TELEMETRYBUFFER_BARRIER(); // Read the slot after seeing the new head
+            uint8_t slot = tail & MASK;
+            mFrameLength = TelemetryFrame::encode(mSamples[slot], mSequences[slot], mFrame);
+            mFramePosition = 0;
+            TELEMETRYBUFFER_BARRIER(); // Release the slot only once it has been read
+            mTail = tail + 1;
+            return true;
+        }
+
+    public:
+        TelemetryBuffer()
+            : mHead(0), mTail(0), mNextSequence(0), mDropped(0), mFrameLength(0), mFramePosition(0) {}
+
+        /**
+         * @brief Queue a sample (writer side). Constant time, never blocks.
+         * @return false if the buffer was full and the sample was dropped.
+         */
+        bool push(const TelemetrySample& sample) {
+            uint8_t head = mHead;
+            uint8_t sequence = mNextSequence++;
+            if ((uint8_t)(head - mTail) >= Capacity) {
+                mDropped = mDropped + 1;
+                return false;
+            }
+            mSamples[head & MASK] = sample;
+            mSequences[head & MASK] = sequence;
+            TELEMETRYBUFFER_BARRIER(); // Publish the slot before the new head
+            mHead = head + 1;
+            return true;
+        }
+
+        /**
+         * @brief Next byte of the stream (reader side), e.g. from the UART TX-empty interrupt.
+         * @param byte The byte to send.
+         * @return false if there is nothing to send.
+         */
+        bool nextByte(uint8_t& byte) {
+            if (!loadFrame()) {
+                return false;
+            }
+            byte = mFrame[mFramePosition++];
+            return true;
+        }
+
+        /**
+         * @brief Send as many bytes as the output accepts without blocking (reader side).
+         * @param out Output with availableForWrite() and write(const uint8_t*, size_t),
+         * e.g. Serial.
+         * @param maxFrames Maximum number of frames started in this call, bounding its time.
+         * @return Number of bytes written.
+         */
+        template <class Output>
+        size_t drain(Output& out, uint8_t maxFrames = Capacity) {
+            size_t written = 0;
+            for (;;) {
+                if (mFramePosition >= mFrameLength) {
+                    if (maxFrames == 0) {
+                        break;
+                    }
+                    maxFrames--;
+                }
+                int room = out.availableForWrite();
+                if (room <= 0 || !loadFrame()) {
+                    break;
+                }
+                size_t length = mFrameLength - mFramePosition;
+                if ((size_t)room < length) {
+                    length = (size_t)room;
+                }
+                out.write(&mFrame[mFramePosition], length);
+                mFramePosition += (uint8_t)length;
+                written += length;
+            }
+            return written;
+        }
+
+        /**
+         * @brief Number of samples waiting (approximate when called from the other side).
+         */
+        uint8_t size() const { return (uint8_t)(mHead - mTail); }
+
+        /**
+         * @brief Samples dropped because the buffer was full.
+         * @note A 32-bit read is not atomic on AVR: read it from the writer's context,
+         * or with interrupts disabled when the writer is an ISR.
+         */
+        uint32_t dropped() const { return mDropped; }
+
+        static uint8_t capacity() { return Capacity; }
+};
+
+#endif
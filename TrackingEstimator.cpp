@@ -0,0 +1,376 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file TrackingEstimator.cpp
+ * @brief Implementation of the tracking-filter speed estimators.
+ */
+
+#include "TrackingEstimator.h"
+#include "SpeedEstimatorFixedPoint.h"
+
+// Initial variance of the velocity (counts^2/s^2) and acceleration (counts^2/s^4):
+// large enough for the first counts to set them
+static const float INITIAL_VELOCITY_VARIANCE = 1.0e8f;
+static const float INITIAL_ACCELERATION_VARIANCE = 1.0e10f;
+
+// Steady-state gain search
+static const uint16_t STEADY_STATE_MAX_STEPS = 20000;
+static const float STEADY_STATE_TOLERANCE = 1.0e-6f;
+
+TrackingGains TrackingGains::steadyState(float processNoise, float measurementNoise, uint32_t periodMicros,
+                                         bool trackAcceleration) {
+    // The covariance, and so the gain, does not depend on the counts: run the filter on
+    // a motionless encoder until the gains stop changing
+    KalmanSpeedEstimator kalman(1.0f, 1.0f, processNoise, measurementNoise, trackAcceleration);
+    uint32_t time = 0;
+    kalman.estimateSpeed(0, time);
+    float previous[3] = {0, 0, 0};
+    for (uint16_t step = 0; step < STEADY_STATE_MAX_STEPS; step++) {
+        time += periodMicros;
+        kalman.estimateSpeed(0, time);
+        bool converged = true;
+        for (uint8_t i = 0; i < 3; i++) {
+            float change = kalman.gain(i) - previous[i];
+            if (change < 0) {
+                change = -change;
+            }
+            float limit = STEADY_STATE_TOLERANCE * (kalman.gain(i) < 0 ? -kalman.gain(i) : kalman.gain(i));
+            converged = converged && change <= limit;
+            previous[i] = kalman.gain(i);
+        }
+        if (converged) {
+            break;
+        }
+    }
+
+    // K = [alpha, beta / T, 2 * gamma / T^2]
+    float period = (float)periodMicros * 1.0e-6f;
+    TrackingGains gains;
+    gains.alpha = previous[0];
+    gains.beta = previous[1] * period;
+    gains.gamma = previous[2] * period * period * 0.5f;
+    return gains;
+}
+
+TrackingGains TrackingGains::observer(float bandwidthHz, uint32_t periodMicros) {
+    float wnT = 2.0f * (float)M_PI * bandwidthHz * (float)periodMicros * 1.0e-6f;
+    if (wnT > MAX_OBSERVER_WNT) {
+        wnT = MAX_OBSERVER_WNT;
+    }
+    TrackingGains gains;
+    gains.alpha = 2.0f * wnT;
+    gains.beta = wnT * wnT;
+    gains.gamma = 0;
+    return gains;
+}
+
+float TrackingGains::maxObserverBandwidth(uint32_t periodMicros) {
+    return MAX_OBSERVER_WNT / (2.0f * (float)M_PI * (float)periodMicros * 1.0e-6f);
+}
+
+KalmanSpeedEstimator::KalmanSpeedEstimator(float ppr, float gearRatio, float processNoise, float measurementNoise,
+                                           bool trackAcceleration)
+    : mStarted(false), mTrackAcceleration(trackAcceleration),
+      mRpmScale(SpeedEstimatorCore::rpmScale(ppr, gearRatio) * 1.0e-6f), mProcessNoise(processNoise), mMeasurementNoise(measurementNoise) {
+    reset();
+}
+
+float KalmanSpeedEstimator::estimateSpeed(int pulsesCount) {
+    return estimateSpeed(pulsesCount, SpeedEstimatorClock::now());
+}
+
+float KalmanSpeedEstimator::estimateSpeed(int pulsesCount, uint32_t timestampMicros) {
+    if (!mStarted) {
+        mStarted = true;
+        mSample.setPrevious(pulsesCount, timestampMicros);
+        return 0;
+    }
+
+    // Wrap-safe differences to the previous sample, which is replaced
+    uint32_t deltaTimeMicros = mSample.advance(timestampMicros);
+    if (deltaTimeMicros == 0) {
+        return speed();
+    }
+    int pulseDiff = mSample.pulseDiff(pulsesCount);
+
+    float dt = (float)deltaTimeMicros * 1.0e-6f;
+    float dt2 = dt * dt * 0.5f;
+
+    // Predict: x = F x, with F = [1 dt dt^2/2; 0 1 dt; 0 0 1]
+    mX[0] += mX[1] * dt + mX[2] * dt2;
+    mX[1] += mX[2] * dt;
+
+    // P = F P F' + Q. Rows of F P first, then the columns
+    float fp[3][3];
+    for (uint8_t j = 0; j < 3; j++) {
+        fp[0][j] = mP[0][j] + mP[1][j] * dt + mP[2][j] * dt2;
+        fp[1][j] = mP[1][j] + mP[2][j] * dt;
+        fp[2][j] = mP[2][j];
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        mP[i][0] = fp[i][0] + fp[i][1] * dt + fp[i][2] * dt2;
+        mP[i][1] = fp[i][1] + fp[i][2] * dt;
+        mP[i][2] = fp[i][2];
+    }
+
+    float q = mProcessNoise * dt;
+    if (mTrackAcceleration) {
+        // Continuous white jerk
+        float dt3 = dt * dt * dt;
+        mP[0][0] += q * dt3 * dt / 20.0f;
+        mP[0][1] += q * dt3 / 8.0f;
+        mP[0][2] += q * dt * dt / 6.0f;
+        mP[1][1] += q * dt * dt / 3.0f;
+        mP[1][2] += q * dt * 0.5f;
+        mP[2][2] += q;
+    } else {
+        // Continuous white acceleration
+        mP[0][0] += q * dt * dt / 3.0f;
+        mP[0][1] += q * dt * 0.5f;
+        mP[1][1] += q;
+    }
+
+    // The position is kept relative to the last count
+    mX[0] -= (float)pulseDiff;
+
+    // Update with the count: residual = count - predicted position
+    float residual = -mX[0];
+    float innovationVariance = mP[0][0] + mMeasurementNoise;
+    float row0[3] = {mP[0][0], mP[0][1], mP[0][2]};
+    for (uint8_t i = 0; i < 3; i++) {
+        mGain[i] = row0[i] / innovationVariance;
+        mX[i] += mGain[i] * residual;
+    }
+    // P = (I - K H) P, computed on the upper triangle and mirrored to stay symmetric
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = i; j < 3; j++) {
+            mP[i][j] -= mGain[i] * row0[j];
+            mP[j][i] = mP[i][j];
+        }
+    }
+
+    return speed();
+}
+
+void KalmanSpeedEstimator::reset() {
+    mSample.reset();
+    mStarted = false;
+    for (uint8_t i = 0; i < 3; i++) {
+        mX[i] = 0;
+        mGain[i] = 0;
+        for (uint8_t j = 0; j < 3; j++) {
+            mP[i][j] = 0;
+        }
+    }
+    mP[0][0] = mMeasurementNoise;
+    mP[1][1] = INITIAL_VELOCITY_VARIANCE;
+    // Without acceleration tracking, the acceleration stays 0 with no variance
+    mP[2][2] = mTrackAcceleration ? INITIAL_ACCELERATION_VARIANCE : 0.0f;
+}
+
+void KalmanSpeedEstimator::setNoise(float processNoise, float measurementNoise) {
+    mProcessNoise = processNoise;
+    mMeasurementNoise = measurementNoise;
+}
+
+AlphaBetaEstimator::AlphaBetaEstimator(float ppr, float gearRatio, uint32_t periodMicros, const TrackingGains& gains)
+    : mStarted(false), mPeriod(periodMicros > 0 ? periodMicros : 1), mAlpha(gains.alpha),
+      mBeta(gains.beta), mGamma2(2.0f * gains.gamma), mCountsToRpm(0), mPosition(0), mVelocity(0),
+      mAcceleration(0) {
+    // RPM per count per period: 60e6 / (ppr * gearRatio * period)
+    mCountsToRpm = SpeedEstimatorCore::rpmScale(ppr, gearRatio) / (float)mPeriod;
+}
+
+float AlphaBetaEstimator::estimateSpeed(int pulsesCount) {
+    int pulseDiff = mSample.pulseDiff(pulsesCount);
+    if (!mStarted) {
+        mStarted = true;
+        return 0;
+    }
+
+    // Predicted position minus the new count
+    float position = mPosition + mVelocity + 0.5f * mAcceleration - (float)pulseDiff;
+    mVelocity += mAcceleration;
+
+    float residual = -position;
+    mPosition = position + mAlpha * residual;
+    mVelocity += mBeta * residual;
+    mAcceleration += mGamma2 * residual;
+
+    return mVelocity * mCountsToRpm;
+}
+
+void AlphaBetaEstimator::reset() {
+    mSample.reset();
+    mStarted = false;
+    mPosition = 0;
+    mVelocity = 0;
+    mAcceleration = 0;
+}
+
+TrackingObserverEstimator::TrackingObserverEstimator(float ppr, float gearRatio, float bandwidthHz)
+    : mStarted(false), mRpmScale(SpeedEstimatorCore::rpmScale(ppr, gearRatio) * 1.0e-6f), mBandwidth(0),
+      mWn(0), mPosition(0), mVelocity(0) {
+    setBandwidth(bandwidthHz);
+}
+
+float TrackingObserverEstimator::estimateSpeed(int pulsesCount) {
+    return estimateSpeed(pulsesCount, SpeedEstimatorClock::now());
+}
+
+float TrackingObserverEstimator::estimateSpeed(int pulsesCount, uint32_t timestampMicros) {
+    if (!mStarted) {
+        mStarted = true;
+        mSample.setPrevious(pulsesCount, timestampMicros);
+        return 0;
+    }
+
+    // Wrap-safe differences to the previous sample, which is replaced
+    uint32_t deltaTimeMicros = mSample.advance(timestampMicros);
+    if (deltaTimeMicros == 0) {
+        return speed();
+    }
+    int pulseDiff = mSample.pulseDiff(pulsesCount);
+
+    float dt = (float)deltaTimeMicros * 1.0e-6f;
+
+    // Position error, with the position kept relative to the last count
+    float error = (float)pulseDiff - mPosition;
+
+    // Beyond the stability limit, this step uses the largest stable bandwidth
+    float wn = mWn;
+    if (wn * dt > TrackingGains::MAX_OBSERVER_WNT) {
+        wn = TrackingGains::MAX_OBSERVER_WNT / dt;
+    }
+
+    // PI loop (Kp = 2 * wn, Ki = wn^2): the integrator is the velocity, the estimate
+    // advances to the next sample
+    mVelocity += wn * wn * dt * error;
+    mPosition = (mVelocity + 2.0f * wn * error) * dt - error;
+
+    return speed();
+}
+
+void TrackingObserverEstimator::reset() {
+    mSample.reset();
+    mStarted = false;
+    mPosition = 0;
+    mVelocity = 0;
+}
+
+void TrackingObserverEstimator::setBandwidth(float bandwidthHz) {
+    mBandwidth = bandwidthHz;
+    mWn = 2.0f * (float)M_PI * bandwidthHz;
+}
+
+// Largest gain shift: beyond it every product (below 2^47) rounds to zero
+static const uint8_t MAX_GAIN_SHIFT = 47;
+
+AlphaBetaEstimatorQ::Gain AlphaBetaEstimatorQ::toGain(float gain) {
+    Gain result = {0, 0};
+    if (!(gain > 0)) {
+        return result;
+    }
+    // Normalize the mantissa to [2^15, 2^16)
+    float scaled = gain * 32768.0f;
+    int shift = 15;
+    while (scaled < 32768.0f && shift < MAX_GAIN_SHIFT) {
+        scaled *= 2.0f;
+        shift++;
+    }
+    while (scaled >= 65536.0f && shift > 0) {
+        scaled *= 0.5f;
+        shift--;
+    }
+    uint32_t mantissa = (uint32_t)(scaled + 0.5f);
+    if (mantissa > 65535UL) {
+        // Rounded up to 2^16
+        if (shift > 0) {
+            mantissa = 32768;
+            shift--;
+        } else {
+            mantissa = 65535;
+        }
+    }
+    result.mantissa = (uint16_t)mantissa;
+    result.shift = (uint8_t)shift;
+    return result;
+}
+
+int32_t AlphaBetaEstimatorQ::applyGain(int32_t x, Gain gain) {
+    // x * mantissa split as hi * 2^16 + lo (hi signed, lo unsigned), as in mulQ16(),
+    // so that neither partial product overflows 32 bits
+    int32_t hi = (x >> 16) * (int32_t)gain.mantissa;
+    uint32_t lo = (uint32_t)(x & 0xFFFF) * gain.mantissa;
+
+    if (gain.shift >= 16) {
+        // Gains below 1: the product over 2^16, rounded, then the remaining shift, rounded
+        int32_t q = hi + (int32_t)((lo + 0x8000UL) >> 16);
+        uint8_t rest = gain.shift - 16;
+        return (rest == 0) ? q : (q >> rest) + ((q >> (rest - 1)) & 1);
+    }
+
+    // Gains of 1 and above: hi * 2^(16 - shift) + lo / 2^shift, saturated
+    uint8_t up = 16 - gain.shift;
+    if (hi > (INT32_MAX >> up)) {
+        return INT32_MAX;
+    }
+    if (hi < (INT32_MIN >> up)) {
+        return INT32_MIN;
+    }
+    uint32_t low = (gain.shift == 0) ? lo : (lo + (1UL << (gain.shift - 1))) >> gain.shift;
+    return addSaturated(hi * (int32_t)(1L << up), (low > (uint32_t)INT32_MAX) ? INT32_MAX : (int32_t)low);
+}
+
+AlphaBetaEstimatorQ::AlphaBetaEstimatorQ(float ppr, float gearRatio, uint32_t periodMicros,
+                                         const TrackingGains& gains)
+    : mStarted(false), mPeriod(periodMicros > 0 ? periodMicros : 1),
+      mPosition(0), mVelocity(0), mAcceleration(0) {
+    // The position is in counts and the velocity in RPM: the RPM per count per
+    // period is folded into the velocity and acceleration gains
+    float countsToRpm = SpeedEstimatorCore::rpmScale(ppr, gearRatio) / (float)mPeriod;
+    mAlpha = toGain(gains.alpha);
+    mBeta = toGain(gains.beta * countsToRpm);
+    mGamma2 = toGain(2.0f * gains.gamma * countsToRpm);
+    mRpmToCounts = toGain(1.0f / countsToRpm);
+}
+
+int32_t AlphaBetaEstimatorQ::estimateSpeedQ(int pulsesCount) {
+    int pulseDiff = mSample.pulseDiff(pulsesCount);
+    if (!mStarted) {
+        mStarted = true;
+        return 0;
+    }
+
+    // The count in Q16.16, saturated
+    int32_t measured;
+    if (pulseDiff > 32767) {
+        measured = INT32_MAX;
+    } else if (pulseDiff < -32767) {
+        measured = -INT32_MAX;
+    } else {
+        measured = (int32_t)pulseDiff * 65536;
+    }
+
+    // Predicted position minus the new count
+    int32_t step = applyGain(addSaturated(mVelocity, mAcceleration / 2), mRpmToCounts);
+    int32_t position = addSaturated(addSaturated(mPosition, step), -measured);
+    mVelocity = addSaturated(mVelocity, mAcceleration);
+
+    int32_t residual = (position == INT32_MIN) ? INT32_MAX : -position;
+    mPosition = addSaturated(position, applyGain(residual, mAlpha));
+    mVelocity = addSaturated(mVelocity, applyGain(residual, mBeta));
+    mAcceleration = addSaturated(mAcceleration, applyGain(residual, mGamma2));
+
+    return mVelocity;
+}
+
+void AlphaBetaEstimatorQ::reset() {
+    mSample.reset();
+    mStarted = false;
+    mPosition = 0;
+    mVelocity = 0;
+    mAcceleration = 0;
+}
@@ -0,0 +1,474 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file TrackingEstimator.h
+ * @brief Tracking-filter speed estimators: Kalman and steady-state alpha-beta(-gamma).
+ *
+ * Instead of differentiating the count and low-pass filtering the result, these
+ * estimators track the encoder position with a constant-velocity model (position,
+ * velocity) or a constant-acceleration model (position, velocity, acceleration),
+ * correcting the prediction with each new count. A ramp in speed is then followed
+ * without the lag of a low-pass filter of the same noise (with acceleration
+ * tracking, with no steady-state lag at all).
+ *
+ * - KalmanSpeedEstimator: full Kalman filter with the measured interval, configured
+ *   with the process and measurement noise. A few dozen float operations per call.
+ * - AlphaBetaEstimator: the same filter once its gains have converged, for a fixed
+ *   period: a few multiply-adds per call.
+ * - AlphaBetaEstimatorQ: AlphaBetaEstimator in fixed point, returning RPM in Q16.16.
+ * - TrackingObserverEstimator: angle tracking observer (type-II phase-locked loop on
+ *   the position) tuned by its bandwidth only, with the measured interval.
+ * - TrackingObserverEstimatorQ: the observer in fixed point, for a fixed period.
+ *
+ * All of them have the estimateSpeed(int pulsesCount) and reset() methods of
+ * SpeedEstimator, so the estimator of a motor can be changed by changing its type.
+ * The state is kept relative to the last count, so large counts lose no precision.
+ * The first call after construction or reset() only initializes the state and
+ * returns 0.
+ */
+
+#ifndef __TRACKINGESTIMATOR_H__
+#define __TRACKINGESTIMATOR_H__
+
+#include <Arduino.h>
+#include "SpeedEstimatorClock.h"
+#include "SpeedEstimatorCore.h"
+
+/**
+ * @struct TrackingGains
+ * @brief Gains of an alpha-beta(-gamma) filter for a fixed period T.
+ *
+ * With the residual r between the measured and the predicted position (in counts),
+ * the correction is: position += alpha * r, velocity += beta / T * r and
+ * acceleration += 2 * gamma / T^2 * r. gamma = 0 gives an alpha-beta filter.
+ */
+struct TrackingGains {
+    float alpha; ///< Position gain (0..1).
+    float beta; ///< Velocity gain (0..2).
+    float gamma; ///< Acceleration gain, 0 without acceleration tracking.
+
+    /**
+     * @brief Steady-state gains of KalmanSpeedEstimator for a fixed period.
+     * @param processNoise Process noise, as in KalmanSpeedEstimator.
+     * @param measurementNoise Measurement noise in counts squared, as in KalmanSpeedEstimator.
+     * @param periodMicros Sample period in microseconds.
+     * @param trackAcceleration true for alpha-beta-gamma gains.
+     * @note The gains are found by iterating the Kalman covariance update until it
+     * converges (up to a few thousand steps). On an 8-bit MCU this takes a noticeable
+     * time, so call it once in setup(), or compute the gains on the host and pass them
+     * as constants.
+     */
+    static TrackingGains steadyState(float processNoise, float measurementNoise, uint32_t periodMicros,
+                                     bool trackAcceleration = false);
+
+    /**
+     * @brief Largest wn * T used by the tracking observer.
+     *
+     * With alpha = 2 * wn * T and beta = (wn * T)^2 the loop is stable while
+     * beta < 4 - 2 * alpha, that is wn * T < 2 * sqrt(2) - 2 (about 0.83). The limit keeps
+     * a margin below it.
+     */
+    static constexpr float MAX_OBSERVER_WNT = 0.8f;
+
+    /**
+     * @brief Gains of the critically damped tracking observer (see TrackingObserverEstimator).
+     * @param bandwidthHz Natural frequency of the loop in Hz.
+     * @param periodMicros Sample period in microseconds.
+     * @return alpha = 2 * wn * T and beta = (wn * T)^2, with wn = 2 * pi * bandwidthHz.
+     * @note The bandwidth is limited to maxObserverBandwidth(periodMicros).
+     */
+    static TrackingGains observer(float bandwidthHz, uint32_t periodMicros);
+
+    /**
+     * @brief Largest stable observer bandwidth at a sample period: MAX_OBSERVER_WNT / (2 * pi * T),
+     * about 0.127 times the sample rate.
+     */
+    static float maxObserverBandwidth(uint32_t periodMicros);
+};
+
+/**
+ * @class KalmanSpeedEstimator
+ * @brief Kalman filter tracking the encoder position, velocity and optionally acceleration.
+ *
+ * The process noise is the spectral density of the white acceleration (counts^2/s^3)
+ * driving the constant-velocity model, or of the white jerk (counts^2/s^5) driving the
+ * constant-acceleration model. Larger values follow speed changes faster and let more
+ * noise through. The measurement noise is the variance of the count: 1/12 counts^2
+ * for the quantization alone.
+ *
+ * Example usage:
+ * @code
+ * KalmanSpeedEstimator speedEstimator(ppr, gearRatio, 1.0e5f); // Quantization-only measurement noise
+ * float speed = speedEstimator.estimateSpeed(currentPulses);
+ * @endcode
+ */
+class KalmanSpeedEstimator {
+    public:
+        static constexpr float QUANTIZATION_NOISE = 1.0f / 12.0f; ///< Variance of a rounded count.
+
+    private:
+        SpeedEstimatorSample mSample; ///< Previous count and timestamp in microseconds.
+        bool mStarted; ///< Whether the first sample has been seen.
+        bool mTrackAcceleration; ///< Constant-acceleration model (3 states) instead of constant-velocity.
+
+        float mRpmScale; ///< RPM per count per second: 60 / (ppr * gearRatio).
+        float mProcessNoise; ///< Process noise spectral density.
+        float mMeasurementNoise; ///< Count variance in counts squared.
+
+        float mX[3]; ///< Position minus the last count (counts), velocity (counts/s), acceleration (counts/s^2).
+        float mP[3][3]; ///< State covariance.
+        float mGain[3]; ///< Kalman gain of the last update.
+
+    public:
+        /**
+         * @brief Constructor for KalmanSpeedEstimator.
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         * @param processNoise Process noise spectral density (see the class description).
+         * @param measurementNoise Count variance in counts squared.
+         * @param trackAcceleration true to also track the acceleration.
+         */
+        KalmanSpeedEstimator(float ppr, float gearRatio, float processNoise,
+                             float measurementNoise = QUANTIZATION_NOISE, bool trackAcceleration = false);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         * @note The sample is timestamped with the compile-time clock policy
+         * (see SpeedEstimatorClock.h), micros() by default.
+         */
+        float estimateSpeed(int pulsesCount);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM from a timestamped sample.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @param timestampMicros Time in microseconds at which pulsesCount was read.
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(int pulsesCount, uint32_t timestampMicros);
+
+        /**
+         * @brief Reset the state; the next call initializes it again.
+         */
+        void reset();
+
+        /**
+         * @brief Change the noise parameters (the state is kept).
+         */
+        void setNoise(float processNoise, float measurementNoise);
+
+        /**
+         * @brief Last estimated speed in RPM.
+         */
+        float speed() const { return mX[1] * mRpmScale; }
+
+        /**
+         * @brief Last estimated acceleration in RPM per second (0 without acceleration tracking).
+         */
+        float acceleration() const { return mX[2] * mRpmScale; }
+
+        /**
+         * @brief Kalman gain of the last update for the position (0), velocity (1) or acceleration (2).
+         */
+        float gain(uint8_t state) const { return mGain[state]; }
+
+        bool tracksAcceleration() const { return mTrackAcceleration; }
+};
+
+/**
+ * @class AlphaBetaEstimator
+ * @brief Steady-state tracking filter for a fixed period: a few multiply-adds per call.
+ *
+ * Example usage:
+ * @code
+ * // 1 kHz loop (e.g. with a TickScheduler), gains of the equivalent Kalman filter
+ * AlphaBetaEstimator speedEstimator(ppr, gearRatio, 1000, TrackingGains::steadyState(1.0e5f, 1.0f / 12, 1000));
+ * float speed = speedEstimator.estimateSpeed(currentPulses);
+ * @endcode
+ */
+class AlphaBetaEstimator {
+    private:
+        SpeedEstimatorSample mSample; ///< Previous count (the timestamp is not used).
+        bool mStarted; ///< Whether the first sample has been seen.
+        uint32_t mPeriod; ///< Sample period in microseconds.
+
+        float mAlpha; ///< Position gain.
+        float mBeta; ///< Velocity gain.
+        float mGamma2; ///< Twice the acceleration gain.
+        float mCountsToRpm; ///< RPM per count per period.
+
+        float mPosition; ///< Position minus the last count (counts).
+        float mVelocity; ///< Velocity in counts per period.
+        float mAcceleration; ///< Acceleration in counts per period squared.
+
+    public:
+        /**
+         * @brief Constructor for AlphaBetaEstimator.
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         * @param periodMicros Period in microseconds at which estimateSpeed() is called.
+         * @param gains Filter gains, e.g. from TrackingGains::steadyState().
+         */
+        AlphaBetaEstimator(float ppr, float gearRatio, uint32_t periodMicros, const TrackingGains& gains);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM, assuming a call every period.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         * @note No clock is read and no division is performed.
+         */
+        float estimateSpeed(int pulsesCount);
+
+        /**
+         * @brief Reset the state; the next call initializes it again.
+         */
+        void reset();
+
+        /**
+         * @brief Last estimated acceleration in RPM per second (0 without acceleration tracking).
+         */
+        float acceleration() const { return mAcceleration * mCountsToRpm * (1.0e6f / (float)mPeriod); }
+
+        uint32_t period() const { return mPeriod; } ///< Sample period in microseconds.
+};
+
+/**
+ * @class AlphaBetaEstimatorQ
+ * @brief AlphaBetaEstimator in integer arithmetic, returning RPM in Q16.16.
+ *
+ * The state is kept in Q16.16: the position in counts, so the tracking error can
+ * reach +/-32767 counts, and the velocity directly in RPM. The gains are folded with
+ * the RPM per count at construction, and each is a 16-bit mantissa with its own
+ * shift, so the small gains of a low bandwidth keep their precision (relative
+ * rounding below 2^-16). As in SpeedEstimatorQ, each product is evaluated with 32-bit
+ * intermediates only (no 64-bit arithmetic on 8-bit targets), and speeds saturate at
+ * about +/-32767 RPM.
+ *
+ * Example usage:
+ * @code
+ * AlphaBetaEstimatorQ speedEstimator(ppr, gearRatio, 1000, TrackingGains{0.2f, 0.02f, 0.0f});
+ * int32_t speedQ16 = speedEstimator.estimateSpeedQ(currentPulses); // RPM in Q16.16
+ * @endcode
+ */
+class AlphaBetaEstimatorQ {
+    private:
+        SpeedEstimatorSample mSample; ///< Previous count (the timestamp is not used).
+        bool mStarted; ///< Whether the first sample has been seen.
+        uint32_t mPeriod; ///< Sample period in microseconds.
+
+        /**
+         * @brief Gain as mantissa / 2^shift.
+         */
+        struct Gain {
+            uint16_t mantissa; ///< 16 significant bits, in [2^15, 2^16) (0 for a zero gain).
+            uint8_t shift; ///< Fractional bits (0..47).
+        };
+
+        Gain mAlpha; ///< Position gain.
+        Gain mBeta; ///< Velocity gain times the RPM per count per period.
+        Gain mGamma2; ///< Twice the acceleration gain times the RPM per count per period.
+        Gain mRpmToCounts; ///< Counts per period per RPM, for the position prediction.
+
+        int32_t mPosition; ///< Position minus the last count, in counts (Q16.16).
+        int32_t mVelocity; ///< Velocity in RPM (Q16.16).
+        int32_t mAcceleration; ///< Velocity change per period in RPM (Q16.16).
+
+        /**
+         * @brief Convert a non-negative factor to a mantissa and a shift.
+         */
+        static Gain toGain(float gain);
+
+        /**
+         * @brief Rounded x * gain, saturated to the int32_t range.
+         */
+        static int32_t applyGain(int32_t x, Gain gain);
+
+    public:
+        /**
+         * @brief Constructor for AlphaBetaEstimatorQ.
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         * @param periodMicros Period in microseconds at which estimateSpeedQ() is called.
+         * @param gains Filter gains, e.g. from TrackingGains::steadyState().
+         * @note Floats are only used here to compute the fixed-point constants.
+         */
+        AlphaBetaEstimatorQ(float ppr, float gearRatio, uint32_t periodMicros, const TrackingGains& gains);
+
+        /**
+         * @brief Calculate the speed of the motor, assuming a call every period.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM, Q16.16.
+         */
+        int32_t estimateSpeedQ(int pulsesCount);
+
+        /**
+         * @brief Drop-in replacement for AlphaBetaEstimator::estimateSpeed().
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(int pulsesCount) { return toFloat(estimateSpeedQ(pulsesCount)); }
+
+        /**
+         * @brief Reset the state; the next call initializes it again.
+         */
+        void reset();
+
+        uint32_t period() const { return mPeriod; } ///< Sample period in microseconds.
+
+        /**
+         * @brief Convert a Q16.16 value to float.
+         */
+        static float toFloat(int32_t valueQ16) { return (float)valueQ16 * (1.0f / 65536.0f); }
+};
+
+/**
+ * @class TrackingObserverEstimator
+ * @brief Angle tracking observer: a phase-locked loop following the encoder position.
+ *
+ * The position error e between the count and the estimated position drives a
+ * proportional-integral loop: the integrator is the speed estimate (speed += Ki * e * dt)
+ * and the position estimate advances with the speed plus the proportional term
+ * (position += (speed + Kp * e) * dt). With Kp = 2 * wn and Ki = wn^2 the loop is
+ * critically damped, so the bandwidth wn = 2 * pi * bandwidthHz is the only setting.
+ *
+ * Unlike differentiation followed by a low-pass filter, the count noise is filtered
+ * by a second-order loop before it reaches the speed, and a constant speed is tracked
+ * with no error. During a constant acceleration the speed lags by 2 / wn seconds.
+ * Keep the bandwidth below a tenth of the sample rate. The loop is unstable from
+ * wn * dt = 2 * sqrt(2) - 2 (about 0.13 times the sample rate): for longer intervals,
+ * the step uses the largest stable bandwidth (TrackingGains::MAX_OBSERVER_WNT / dt).
+ *
+ * Example usage:
+ * @code
+ * TrackingObserverEstimator speedEstimator(ppr, gearRatio, 10.0f); // 10 Hz bandwidth
+ * float speed = speedEstimator.estimateSpeed(currentPulses);
+ * @endcode
+ */
+class TrackingObserverEstimator {
+    private:
+        SpeedEstimatorSample mSample; ///< Previous count and timestamp in microseconds.
+        bool mStarted; ///< Whether the first sample has been seen.
+
+        float mRpmScale; ///< RPM per count per second: 60 / (ppr * gearRatio).
+        float mBandwidth; ///< Loop natural frequency in Hz.
+        float mWn; ///< Loop natural frequency in rad/s: the gains are Kp = 2 * wn and Ki = wn^2.
+
+        float mPosition; ///< Estimated position minus the last count (counts).
+        float mVelocity; ///< Estimated velocity (counts/s).
+
+    public:
+        /**
+         * @brief Constructor for TrackingObserverEstimator.
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         * @param bandwidthHz Natural frequency of the loop in Hz.
+         */
+        TrackingObserverEstimator(float ppr, float gearRatio, float bandwidthHz);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         * @note The sample is timestamped with the compile-time clock policy
+         * (see SpeedEstimatorClock.h), micros() by default.
+         */
+        float estimateSpeed(int pulsesCount);
+
+        /**
+         * @brief Calculate the speed of the motor in RPM from a timestamped sample.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @param timestampMicros Time in microseconds at which pulsesCount was read.
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(int pulsesCount, uint32_t timestampMicros);
+
+        /**
+         * @brief Reset the state; the next call initializes it again.
+         */
+        void reset();
+
+        /**
+         * @brief Change the bandwidth (the state is kept).
+         */
+        void setBandwidth(float bandwidthHz);
+
+        float bandwidth() const { return mBandwidth; } ///< Loop natural frequency in Hz.
+
+        /**
+         * @brief Last estimated speed in RPM.
+         */
+        float speed() const { return mVelocity * mRpmScale; }
+};
+
+/**
+ * @class TrackingObserverEstimatorQ
+ * @brief TrackingObserverEstimator in fixed point for a fixed period, returning RPM in Q16.16.
+ *
+ * At a fixed period the observer is an alpha-beta filter with gains set by the
+ * bandwidth (TrackingGains::observer()), so it runs on AlphaBetaEstimatorQ, with its
+ * range and cost. The loop is unstable from wn * T = 2 * sqrt(2) - 2, about 0.13 times
+ * the sample rate, so the bandwidth is limited to TrackingGains::maxObserverBandwidth().
+ * During an acceleration a (counts/s^2) the position error is a / wn^2 counts, well
+ * within the +/-32767 counts of AlphaBetaEstimatorQ at any usable bandwidth.
+ *
+ * Example usage:
+ * @code
+ * TrackingObserverEstimatorQ speedEstimator(ppr, gearRatio, 1000, 10.0f); // 1 kHz, 10 Hz bandwidth
+ * int32_t speedQ16 = speedEstimator.estimateSpeedQ(currentPulses); // RPM in Q16.16
+ * @endcode
+ */
+class TrackingObserverEstimatorQ {
+    private:
+        AlphaBetaEstimatorQ mFilter; ///< The loop, with the observer gains.
+        float mBandwidth; ///< Loop natural frequency in Hz.
+
+    public:
+        /**
+         * @brief Constructor for TrackingObserverEstimatorQ.
+         * @param ppr Pulses per revolution of the encoder.
+         * @param gearRatio Gear ratio of the motor.
+         * @param periodMicros Period in microseconds at which estimateSpeedQ() is called.
+         * @param bandwidthHz Natural frequency of the loop in Hz, limited to
+         * TrackingGains::maxObserverBandwidth(periodMicros).
+         */
+        TrackingObserverEstimatorQ(float ppr, float gearRatio, uint32_t periodMicros, float bandwidthHz)
+            : mFilter(ppr, gearRatio, periodMicros, TrackingGains::observer(bandwidthHz, periodMicros)),
+              mBandwidth(bandwidthHz) {
+            float limit = TrackingGains::maxObserverBandwidth(periodMicros);
+            if (mBandwidth > limit) {
+                mBandwidth = limit;
+            }
+        }
+
+        /**
+         * @brief Calculate the speed of the motor, assuming a call every period.
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM, Q16.16.
+         */
+        int32_t estimateSpeedQ(int pulsesCount) { return mFilter.estimateSpeedQ(pulsesCount); }
+
+        /**
+         * @brief Drop-in replacement for TrackingObserverEstimator::estimateSpeed().
+         * @param pulsesCount The number of pulses counted by the encoder.
+         * @return The calculated speed in RPM.
+         */
+        float estimateSpeed(int pulsesCount) { return mFilter.estimateSpeed(pulsesCount); }
+
+        /**
+         * @brief Reset the state; the next call initializes it again.
+         */
+        void reset() { mFilter.reset(); }
+
+        float bandwidth() const { return mBandwidth; } ///< Loop natural frequency in Hz, after the limit.
+        uint32_t period() const { return mFilter.period(); } ///< Sample period in microseconds.
+
+        /**
+         * @brief Convert a Q16.16 value to float.
+         */
+        static float toFloat(int32_t valueQ16) { return AlphaBetaEstimatorQ::toFloat(valueQ16); }
+};
+
+#endif
@@ -3,8 +3,9 @@
 // For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
 
 #include <Arduino.h>
-#include <util/atomic.h>
 #include <SpeedEstimator.h>
+#include <QuadratureDecoder.h>
+#include <SamplingScheduler.h>
 
 // Motor control pins
 // Modify these pin definitions as per your wiring
@@ -22,11 +23,18 @@ float ppr = 22.0; // Pulses per revolution
 float gearRatio = 9.3; // Gear ratio
 SpeedEstimator speedEstimator(ppr, gearRatio);
 
+// Sample every 10 ms, the period the default filter is designed for
+SamplingScheduler scheduler(10000);
+
 // NOTE: These steps are mandatory to use the SpeedEstimator class!
 // Implement your own method to read encoder pulses. This is just a simplified example.
 
-// Global variables: Encoder counter
-volatile int pos_i = 0;
+// Quadrature decoder: 2x resolution counts both edges of channel A (ppr above)
+QuadratureDecoder decoder(ENCA, ENCB, QUADRATURE_2X);
+
+// Global variables: Encoder counter and timestamp of its last edge, written by the ISR
+// and read by the loop without disabling interrupts
+EncoderSnapshot encoder;
 
 // Method to read encoder pulses
 void readEncoderPulses();
@@ -45,37 +53,41 @@ void setup() {
     digitalWrite(IN2, LOW);
     analogWrite(ENA, 0); // Set speed (0-255)
 
-    // Setting up encoder interrupts (example for Arduino Uno or Nano (using pin 2 and 3) with a simple encoder)
-    attachInterrupt(digitalPinToInterrupt(ENCA), readEncoderPulses, RISING);
-    attachInterrupt(digitalPinToInterrupt(ENCB), readEncoderPulses, RISING);
+    // Setting up encoder interrupts (example for Arduino Uno or Nano (using pin 2 and 3) with a quadrature encoder)
+    decoder.begin();
+    decoder.attach(readEncoderPulses);
+
+    // First sample due now
+    scheduler.begin();
 }
 
 void loop() {
+    // Runs once per period, at fixed deadlines (the rest of the loop must take less than 10 ms)
+    if (!scheduler.poll()) {
+        return;
+    }
+
     // Vary speed based on the elapsed time for demonstration
     long elapsed = millis();
     int speedValue = (elapsed / 10) % 256; // Speed value between 0-255
     analogWrite(ENA, speedValue);
 
-    // Read the position in an atomic block to avoid inconsistency due to interrupts
-    int currentPulses;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        currentPulses = pos_i;
-    }
-    // Estimate speed
-    float speed = speedEstimator.estimateSpeed(currentPulses);
+    // Estimate speed: the count and its edge timestamp are read consistently
+    // from the snapshot (retrying if the ISR updates it meanwhile)
+    float speed = speedEstimator.estimateSpeed(encoder);
 
     // Serial.print("Motor Speed: ");
     Serial.print(speed);
     Serial.print(" ");
     Serial.println(0);
     // Serial.println(" RPM");
-
-    delay(10); // Simulate periodic updates
 }
 
 void readEncoderPulses()
 {
-  // Just a simple counter increment example
-  // In a real scenario, you would read the encoder pins and determine direction
-  pos_i++;
+  // Decode direction from both channels and publish the count with the edge timestamp
+  int8_t step = decoder.update();
+  if (step != 0) {
+    encoder.increment(step, micros());
+  }
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+// Streams every speed sample at 1 kHz as binary telemetry frames. The samples are
+// queued in a TelemetryBuffer and sent when the UART has room, so a busy serial
+// port never delays the next sample.
+// Decode on the host with:
+//   python3 extras/telemetry/decode_telemetry.py --port /dev/ttyACM0 --baud 500000 > samples.csv
+
+#include <Arduino.h>
+#include <SpeedEstimator.h>
+#include <QuadratureDecoder.h>
+#include <Telemetry.h>
+#include <TelemetryBuffer.h>
+#include <SamplingScheduler.h>
+
+// Encoder pins (change as needed)
+#define ENCA 3
+#define ENCB 2
+
+// 1 ms sample period
+#define SAMPLE_US 1000
+
+// Encoder parameters, 20 Hz bandwidth at 1 kHz
+float ppr = 22.0; // Pulses per revolution
+float gearRatio = 9.3; // Gear ratio
+SpeedEstimator speedEstimator(ppr, gearRatio, IIRFilter::butterworth2(20.0f, SAMPLE_US * 1e-6f));
+
+QuadratureDecoder decoder(ENCA, ENCB, QUADRATURE_2X);
+EncoderSnapshot encoder;
+
+// Up to 16 ms of samples waiting for the UART
+TelemetryBuffer<16> telemetry;
+SamplingScheduler scheduler(SAMPLE_US);
+
+void readEncoderPulses()
+{
+  int8_t step = decoder.update();
+  if (step != 0) {
+    encoder.increment(step, micros());
+  }
+}
+
+void setup() {
+    // 21 bytes per frame at 1 kHz: 21 kB/s
+    Serial.begin(500000);
+
+    decoder.begin();
+    decoder.attach(readEncoderPulses);
+    scheduler.begin(micros());
+}
+
+void loop() {
+    // Send what fits in the TX buffer, without waiting
+    telemetry.drain(Serial);
+
+    // One sample per period, without drift; late ones are counted in scheduler.overruns()
+    uint32_t now = micros();
+    if (!scheduler.poll(now)) {
+        return;
+    }
+
+    int32_t count;
+    uint32_t edgeTime;
+    encoder.read(count, edgeTime);
+    // M/T mode: the pulses over the time between the last edges of both samples
+    float speed = speedEstimator.estimateSpeedMT((int)count, edgeTime, now);
+
+    // Constant time; counted in telemetry.dropped() and seen as lost frames if full
+    telemetry.push(TelemetrySample{now, count, speedEstimator.filter().input(), speed});
+}
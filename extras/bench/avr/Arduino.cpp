@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file Arduino.cpp
+ * @brief Implementation of the bare-metal Arduino API used by the AVR cycle benchmarks.
+ */
+
+#include "Arduino.h"
+
+static volatile unsigned long timer0OverflowCount = 0;
+
+ISR(TIMER0_OVF_vect) { timer0OverflowCount++; }
+
+void init() {
+    TCCR0A = 0;
+    TCCR0B = _BV(CS01) | _BV(CS00); // F_CPU / 64, as the Arduino core
+    TIMSK0 = _BV(TOIE0);
+}
+
+unsigned long micros() {
+    // Same algorithm as the Arduino core (wiring.c)
+    uint8_t oldSREG = SREG;
+    cli();
+    unsigned long overflows = timer0OverflowCount;
+    uint8_t ticks = TCNT0;
+    if ((TIFR0 & _BV(TOV0)) && (ticks < 255)) {
+        overflows++;
+    }
+    SREG = oldSREG;
+    return ((overflows << 8) + ticks) * (64 / (F_CPU / 1000000L));
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    uint8_t mask = digitalPinToBitMask(pin);
+    volatile uint8_t* modeRegister = portModeRegister(digitalPinToPort(pin));
+    volatile uint8_t* outputRegister = portOutputRegister(digitalPinToPort(pin));
+
+    uint8_t oldSREG = SREG;
+    cli();
+    if (mode == OUTPUT) {
+        *modeRegister |= mask;
+    } else {
+        *modeRegister &= ~mask;
+        if (mode == INPUT_PULLUP) {
+            *outputRegister |= mask;
+        } else {
+            *outputRegister &= ~mask;
+        }
+    }
+    SREG = oldSREG;
+}
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file Arduino.h
+ * @brief Minimal bare-metal Arduino API for the AVR cycle benchmarks (ATmega328P and ATmega2560).
+ *
+ * Provides what the library sources use, without the Arduino core, so the benchmark
+ * builds with plain avr-gcc. micros() and its Timer0 overflow interrupt follow the
+ * Arduino core implementation (Timer0 at F_CPU / 64), so its cost is representative.
+ * Only the encoder pins of the example are mapped on the ATmega2560 (2 = PE4, 3 = PE5).
+ * attachInterrupt() is a stub: the benchmark calls the ISR body directly.
+ */
+
+#ifndef __AVR_BENCH_ARDUINO_H__
+#define __AVR_BENCH_ARDUINO_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#define LOW 0
+#define HIGH 1
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#if defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+#define digitalPinToPort(pin) (0)
+#define digitalPinToBitMask(pin) ((pin) == 2 ? _BV(4) : _BV(5))
+#define digitalPinToInterrupt(pin) ((pin) == 2 ? 4 : 5)
+#define portInputRegister(port) (&PINE)
+#define portModeRegister(port) (&DDRE)
+#define portOutputRegister(port) (&PORTE)
+#else
+#define digitalPinToPort(pin) ((pin) < 8 ? 0 : 1)
+#define digitalPinToBitMask(pin) ((pin) < 8 ? _BV(pin) : _BV((pin) - 8))
+#define digitalPinToInterrupt(pin) ((pin) == 2 ? 0 : ((pin) == 3 ? 1 : -1))
+#define portInputRegister(port) ((port) == 0 ? &PIND : &PINB)
+#define portModeRegister(port) ((port) == 0 ? &DDRD : &DDRB)
+#define portOutputRegister(port) ((port) == 0 ? &PORTD : &PORTB)
+#endif
+
+/**
+ * @brief Start Timer0 for micros() (call once, before sei()).
+ */
+void init();
+
+unsigned long micros();
+
+void pinMode(uint8_t pin, uint8_t mode);
+
+inline void attachInterrupt(uint8_t, void (*)(), int) {}
+inline void detachInterrupt(uint8_t) {}
+inline void noInterrupts() { cli(); }
+inline void interrupts() { sei(); }
+
+#endif
@@ -0,0 +1,300 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file estimator_cycles.cpp
+ * @brief Cycle counts and stack usage of the library hot paths on AVR, run under simavr.
+ *
+ * Timer1 runs at the CPU clock, so TCNT1 read before and after a call, with
+ * interrupts disabled, gives its exact cost in cycles. The cost of the measurement
+ * itself (call of an empty function) is subtracted. Each function is called
+ * ITERATIONS times with changing inputs (the float routines take data-dependent time)
+ * and the minimum, maximum and mean are reported.
+ *
+ * The stack high-water mark is measured by painting the free RAM below the stack
+ * pointer with a pattern before the calls and looking for the lowest overwritten byte
+ * afterwards.
+ *
+ * readEncoderPulses is the ISR body of examples/speedReading.cpp, called directly. Its
+ * dispatch through attachInterrupt() (vector, register saves, function pointer call)
+ * comes on top.
+ *
+ * The fixed-point estimators are called with the same inputs and settings as their
+ * float counterparts, and the ratio of the mean cycle counts is printed at the end.
+ *
+ * The results are printed on USART0. See the Makefile in this directory.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "Arduino.h"
+#include "SpeedEstimator.h"
+#include "SpeedEstimatorQ.h"
+#include "SpeedEstimatorT.h"
+#include "TrackingEstimator.h"
+#include "QuadratureDecoder.h"
+
+static const uint16_t ITERATIONS = 200;
+static const uint8_t STACK_PATTERN = 0xA5;
+
+// Same configuration as examples/speedReading.cpp
+#define ENCA 3
+#define ENCB 2
+
+SpeedEstimator speedEstimator(22.0f, 9.3f);
+SpeedEstimator fixedEstimator(22.0f, 9.3f);
+SpeedEstimatorQ speedEstimatorQ(22.0f, 9.3f);
+SpeedEstimatorT<22, 93, 10, 10000> speedEstimatorT;
+AlphaBetaEstimator alphaBeta(22.0f, 9.3f, 10000, TrackingGains{0.3f, 0.05f, 0.002f});
+AlphaBetaEstimatorQ alphaBetaQ(22.0f, 9.3f, 10000, TrackingGains{0.3f, 0.05f, 0.002f});
+QuadratureDecoder decoder(ENCA, ENCB, QUADRATURE_2X);
+EncoderSnapshot encoder;
+
+volatile float sinkFloat;
+volatile int32_t sinkInt;
+
+void readEncoderPulses()
+{
+  // Decode direction from both channels and publish the count with the edge timestamp
+  int8_t step = decoder.update();
+  if (step != 0) {
+    encoder.increment(step, micros());
+  }
+}
+
+// ============================================================================
+// Benchmarked calls. Inputs change with the iteration number.
+// ============================================================================
+typedef void (*BenchFunction)(uint16_t i);
+
+static void benchEmpty(uint16_t) {}
+
+static void benchEstimateSpeed(uint16_t i) { sinkFloat = speedEstimator.estimateSpeed((int)(i * 7)); }
+
+static void benchEstimateSpeedTimestamp(uint16_t i) {
+    sinkFloat = speedEstimator.estimateSpeed((int)(i * 7), (uint32_t)i * 10000UL + (i & 15));
+}
+
+static void benchEstimateSpeedSnapshot(uint16_t) { sinkFloat = speedEstimator.estimateSpeed(encoder); }
+
+static void benchEstimateSpeedFixed(uint16_t i) { sinkFloat = fixedEstimator.estimateSpeed((int)(i * 7)); }
+
+static void benchReset(uint16_t) { speedEstimator.reset(); }
+
+static void benchEstimateSpeedQ(uint16_t i) {
+    sinkInt = speedEstimatorQ.estimateSpeedQ((int)(i * 7), (uint32_t)i * 10000UL + (i & 15));
+}
+
+static void benchEstimateSpeedT(uint16_t i) { sinkFloat = speedEstimatorT.estimateSpeed((int)(i * 7)); }
+
+static void benchAlphaBeta(uint16_t i) { sinkFloat = alphaBeta.estimateSpeed((int)(i * 7)); }
+
+static void benchAlphaBetaQ(uint16_t i) { sinkInt = alphaBetaQ.estimateSpeedQ((int)(i * 7)); }
+
+static void benchReadEncoderPulses(uint16_t) { readEncoderPulses(); }
+
+/**
+ * @brief Before each ISR call, move channel A/B one step along the forward Gray sequence.
+ */
+static void prepareEncoderEdge(uint16_t i) {
+    static const uint8_t A[4] = {1, 1, 0, 0};
+    static const uint8_t B[4] = {0, 1, 1, 0};
+    volatile uint8_t* port = portOutputRegister(digitalPinToPort(ENCA));
+    uint8_t value = *port & ~(digitalPinToBitMask(ENCA) | digitalPinToBitMask(ENCB));
+    if (A[i & 3]) {
+        value |= digitalPinToBitMask(ENCA);
+    }
+    if (B[i & 3]) {
+        value |= digitalPinToBitMask(ENCB);
+    }
+    *port = value;
+}
+
+// ============================================================================
+// Measurement
+// ============================================================================
+extern uint8_t __bss_end;
+
+struct Measurement {
+    uint16_t minCycles;
+    uint16_t maxCycles;
+    uint32_t totalCycles;
+    uint16_t stackBytes;
+};
+
+/**
+ * @brief Fill the free RAM between the static data and the current stack pointer.
+ */
+static void __attribute__((noinline)) paintStack() {
+    uint8_t* p = &__bss_end;
+    uint8_t* top = (uint8_t*)SP - 8; // Keep clear of this function's own frame
+    while (p < top) {
+        *p++ = STACK_PATTERN;
+    }
+}
+
+/**
+ * @brief Lowest address written since paintStack().
+ */
+static uint8_t* lowestUsedAddress() {
+    uint8_t* p = &__bss_end;
+    while (*p == STACK_PATTERN && p < (uint8_t*)SP) {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * @brief Cycles of one call, interrupts disabled, including the call itself.
+ */
+static uint16_t __attribute__((noinline)) timeCall(BenchFunction function, uint16_t i) {
+    uint8_t oldSREG = SREG;
+    cli();
+    TCNT1 = 0;
+    function(i);
+    uint16_t cycles = TCNT1;
+    SREG = oldSREG;
+    return cycles;
+}
+
+static Measurement measure(BenchFunction function, void (*prepare)(uint16_t), uint16_t overhead) {
+    Measurement m = {0xFFFF, 0, 0, 0};
+
+    paintStack();
+    uint8_t* callerStack = (uint8_t*)SP;
+    for (uint16_t i = 0; i < ITERATIONS; i++) {
+        if (prepare != nullptr) {
+            prepare(i);
+        }
+        uint16_t cycles = timeCall(function, i);
+        cycles = (cycles > overhead) ? cycles - overhead : 0;
+        if (cycles < m.minCycles) {
+            m.minCycles = cycles;
+        }
+        if (cycles > m.maxCycles) {
+            m.maxCycles = cycles;
+        }
+        m.totalCycles += cycles;
+        // Let the Timer0 overflow interrupt run between calls
+        sei();
+    }
+    m.stackBytes = (uint16_t)(callerStack - lowestUsedAddress());
+    return m;
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+static void uartPrint(const char* text) {
+    while (*text) {
+        while (!(UCSR0A & _BV(UDRE0))) {
+        }
+        UDR0 = *text++;
+    }
+}
+
+static void uartPrintNumber(uint32_t value) {
+    char buffer[11];
+    uint8_t i = sizeof(buffer) - 1;
+    buffer[i] = '\0';
+    do {
+        buffer[--i] = '0' + (value % 10);
+        value /= 10;
+    } while (value != 0);
+    uartPrint(&buffer[i]);
+}
+
+/**
+ * @brief Print a ratio given in hundredths, e.g. 250 as 2.50.
+ */
+static void uartPrintHundredths(uint32_t value) {
+    uartPrintNumber(value / 100);
+    uartPrint(".");
+    if (value % 100 < 10) {
+        uartPrint("0");
+    }
+    uartPrintNumber(value % 100);
+}
+
+static void report(const char* name, const Measurement& m) {
+    uint32_t meanCycles = m.totalCycles / ITERATIONS;
+    uartPrint(name);
+    uartPrint(": cycles min=");
+    uartPrintNumber(m.minCycles);
+    uartPrint(" max=");
+    uartPrintNumber(m.maxCycles);
+    uartPrint(" mean=");
+    uartPrintNumber(meanCycles);
+    uartPrint(" (");
+    // Mean time in 1/100 us
+    uartPrintNumber(meanCycles * 100UL / (F_CPU / 1000000UL));
+    uartPrint("e-2 us) stack=");
+    uartPrintNumber(m.stackBytes);
+    uartPrint(" bytes\n");
+}
+
+/**
+ * @brief Speed-up of a fixed-point call over its float counterpart, from the mean cycles.
+ */
+static void reportSpeedup(const char* name, const Measurement& floatCall, const Measurement& fixedCall) {
+    uartPrint(name);
+    uartPrint(": float mean / fixed-point mean = ");
+    if (fixedCall.totalCycles == 0) {
+        uartPrint("n/a\n");
+        return;
+    }
+    // At most ITERATIONS * 65535 cycles each: times 100 still fits 32 bits
+    uartPrintHundredths(floatCall.totalCycles * 100UL / fixedCall.totalCycles);
+    uartPrint("\n");
+}
+
+int main() {
+    UBRR0 = 8; // 115200 baud at 16 MHz
+    UCSR0B = _BV(TXEN0);
+
+    init();
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10); // Timer1 at the CPU clock
+
+    fixedEstimator.setFixedPeriod(10000);
+    decoder.begin();
+    // Drive the encoder pins from the firmware: PINx then reads back the written levels
+    pinMode(ENCA, OUTPUT);
+    pinMode(ENCB, OUTPUT);
+    sei();
+
+    // Cost of the measurement itself
+    Measurement empty = measure(benchEmpty, nullptr, 0);
+    uint16_t overhead = empty.minCycles;
+    uartPrint("measurement overhead: ");
+    uartPrintNumber(overhead);
+    uartPrint(" cycles (subtracted)\n");
+
+    report("SpeedEstimator::estimateSpeed(int)", measure(benchEstimateSpeed, nullptr, overhead));
+    Measurement floatTimestamp = measure(benchEstimateSpeedTimestamp, nullptr, overhead);
+    report("SpeedEstimator::estimateSpeed(int, uint32_t)", floatTimestamp);
+    report("SpeedEstimator::estimateSpeed(int), fixed period", measure(benchEstimateSpeedFixed, nullptr, overhead));
+    report("SpeedEstimator::reset", measure(benchReset, nullptr, overhead));
+    report("readEncoderPulses (example ISR body)", measure(benchReadEncoderPulses, prepareEncoderEdge, overhead));
+    report("SpeedEstimator::estimateSpeed(EncoderSnapshot)", measure(benchEstimateSpeedSnapshot, nullptr, overhead));
+    Measurement fixedTimestamp = measure(benchEstimateSpeedQ, nullptr, overhead);
+    report("SpeedEstimatorQ::estimateSpeedQ(int, uint32_t)", fixedTimestamp);
+    report("SpeedEstimatorT::estimateSpeed(int)", measure(benchEstimateSpeedT, nullptr, overhead));
+    Measurement floatAlphaBeta = measure(benchAlphaBeta, nullptr, overhead);
+    report("AlphaBetaEstimator::estimateSpeed(int)", floatAlphaBeta);
+    Measurement fixedAlphaBeta = measure(benchAlphaBetaQ, nullptr, overhead);
+    report("AlphaBetaEstimatorQ::estimateSpeedQ(int)", fixedAlphaBeta);
+
+    reportSpeedup("SpeedEstimatorQ vs SpeedEstimator (timestamped)", floatTimestamp, fixedTimestamp);
+    reportSpeedup("AlphaBetaEstimatorQ vs AlphaBetaEstimator", floatAlphaBeta, fixedAlphaBeta);
+    uartPrint("estimator_cycles: DONE\n");
+
+    // Sleeping with interrupts disabled stops simavr
+    cli();
+    sleep_enable();
+    sleep_cpu();
+    return 0;
+}
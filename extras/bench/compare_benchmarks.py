@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+# SPDX-License-Identifier: MIT
+# For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+"""Compare two estimator_benchmarks JSON result files.
+
+Prints the change of every benchmark and exits with status 1 if any of them is
+slower than the baseline by more than the threshold, or if the two files do not
+list the same benchmarks (regenerate the baseline after adding or renaming one):
+
+    compare_benchmarks.py baseline.json results.json [--threshold 10] [--allow-missing]
+
+Baselines are only comparable on the same machine and build type.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as file:
+        data = json.load(file)
+    return {(b["name"], b["variant"]): b["ns_per_call"] for b in data["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="stored baseline results")
+    parser.add_argument("current", help="new results")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="maximum allowed slowdown in percent (default: 10)")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="accept baseline entries absent from the results (runs with --filter)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    unmatched = 0
+    print("%-58s %-12s %10s %10s %9s" % ("benchmark", "variant", "base ns", "new ns", "change"))
+    for key in sorted(set(baseline) | set(current)):
+        name, variant = key
+        if key not in baseline:
+            print("%-58s %-12s %10s %10.2f %9s" % (name, variant, "-", current[key], "new"))
+            unmatched += 1
+            continue
+        if key not in current:
+            print("%-58s %-12s %10.2f %10s %9s" % (name, variant, baseline[key], "-", "missing"))
+            if not args.allow_missing:
+                unmatched += 1
+            continue
+
+        change = (current[key] - baseline[key]) / baseline[key] * 100.0 if baseline[key] > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print("%-58s %-12s %10.2f %10.2f %+8.1f%%%s" % (name, variant, baseline[key], current[key], change, flag))
+
+    if unmatched:
+        print("\n%d benchmark(s) new or missing: regenerate the baseline" % unmatched)
+    if regressions:
+        print("\n%d benchmark(s) slower than the baseline by more than %.1f%%" % (regressions, args.threshold))
+    if unmatched or regressions:
+        return 1
+    print("\nNo regression above %.1f%%" % args.threshold)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,587 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file estimator_benchmarks.cpp
+ * @brief Host microbenchmarks of every estimator mode and filter, with JSON output.
+ *
+ * Each benchmark is measured in up to three variants:
+ * - warm_single: one instance called in a tight loop (state and code in L1). Each call
+ *   depends on the filter state left by the previous one, so this is the latency.
+ * - warm_many: MANY_INSTANCES instances called round-robin (state spills out of L1/L2,
+ *   like a controller with many channels). Calls are independent: this is the throughput.
+ * - cold_single: the caches are flushed with a large buffer walk before every call, and
+ *   the call is timed alone (first call after other work).
+ *
+ * Built by the CMake host build:
+ *   estimator_benchmarks [--json results.json] [--filter text] [--quick]
+ * Compare two result files with compare_benchmarks.py.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "SpeedEstimator.h"
+#include "SpeedEstimatorBank.h"
+#include "SpeedEstimatorQ.h"
+#include "SpeedEstimatorT.h"
+#include "TrackingEstimator.h"
+#include "QuadratureDecoder.h"
+#include "extras/scan/ParallelScanFilter.h"
+#include "extras/simd/SimdSpeedBank.h"
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+static const size_t MANY_INSTANCES = 4096;
+static const float PPR = 22.0f;
+static const float GEAR_RATIO = 9.3f;
+
+/**
+ * @brief Command line options.
+ */
+struct Options {
+    const char* jsonPath = nullptr;
+    const char* filter = nullptr;
+    bool quick = false;
+};
+
+/**
+ * @brief One measurement.
+ */
+struct Result {
+    string name;
+    string variant;
+    double nsPerCall;
+    size_t calls;
+};
+
+// Results are accumulated here so the compiler cannot drop the calls
+static volatile float sink;
+
+// ============================================================================
+// Synthetic encoder trace, computed from the call index
+// ============================================================================
+static uint32_t jitter[256];
+static int noise[256];
+
+static void initTrace() {
+    uint32_t seed = 12345;
+    for (int i = 0; i < 256; i++) {
+        seed = seed * 1103515245UL + 12345UL;
+        jitter[i] = (seed >> 16) % 200;
+        noise[i] = (int)((seed >> 8) % 3);
+    }
+}
+
+/// Timestamp of call i: 10 ms loop with jitter.
+static inline uint32_t traceTime(uint32_t i) { return i * 10000UL + jitter[i & 255]; }
+
+/// Pulse count at call i: ~5 pulses per sample.
+static inline int traceCount(uint32_t i) { return (int)(i * 5) + noise[i & 255]; }
+
+// ============================================================================
+// Benchmarks: constructed with a number of instances, call(instance, i) runs one call.
+// ITEMS_PER_CALL > 1 reports the time per sample or channel of block calls.
+// ============================================================================
+struct EstimateSpeedTimestamp {
+    static const char* name() { return "SpeedEstimator::estimateSpeed(int, uint32_t)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedTimestamp(size_t n) : estimators(n, SpeedEstimator(PPR, GEAR_RATIO)) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct EstimateSpeedClock {
+    static const char* name() { return "SpeedEstimator::estimateSpeed(int)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedClock(size_t n) : estimators(n, SpeedEstimator(PPR, GEAR_RATIO)) {}
+    float call(size_t k, uint32_t i) {
+        // Includes the shim clock read and advance
+        hostAdvanceMicros(10000);
+        return estimators[k].estimateSpeed(traceCount(i));
+    }
+};
+
+struct EstimateSpeedFixedPeriod {
+    static const char* name() { return "SpeedEstimator::estimateSpeed(int), fixed period"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedFixedPeriod(size_t n) : estimators(n, SpeedEstimator(PPR, GEAR_RATIO)) {
+        for (size_t k = 0; k < n; k++) {
+            estimators[k].setFixedPeriod(10000);
+        }
+    }
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i)); }
+};
+
+struct EstimateSpeedButterworth2 {
+    static const char* name() { return "SpeedEstimator::estimateSpeed, butterworth2"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedButterworth2(size_t n)
+        : estimators(n, SpeedEstimator(PPR, GEAR_RATIO, IIRFilter::butterworth2(5.0f, 0.01f))) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct EstimateSpeedAdaptive {
+    static const char* name() { return "SpeedEstimator::estimateSpeed, AdaptiveFilterTable"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    AdaptiveFilterTable table;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedAdaptive(size_t n) : table(5.0f, 10000), estimators(n, SpeedEstimator(PPR, GEAR_RATIO)) {
+        for (size_t k = 0; k < n; k++) {
+            estimators[k].setAdaptiveFilter(&table);
+        }
+    }
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct EstimateSpeedFromPeriod {
+    static const char* name() { return "SpeedEstimator::estimateSpeedFromPeriod"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedFromPeriod(size_t n) : estimators(n, SpeedEstimator(PPR, GEAR_RATIO)) {}
+    float call(size_t k, uint32_t i) {
+        uint32_t now = traceTime(i);
+        return estimators[k].estimateSpeedFromPeriod(traceCount(i), now - 300, 2000 + jitter[i & 255], now);
+    }
+};
+
+struct EstimateSpeedMT {
+    static const char* name() { return "SpeedEstimator::estimateSpeedMT"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    explicit EstimateSpeedMT(size_t n) : estimators(n, SpeedEstimator(PPR, GEAR_RATIO)) {}
+    float call(size_t k, uint32_t i) {
+        uint32_t now = traceTime(i);
+        return estimators[k].estimateSpeedMT(traceCount(i), now - jitter[i & 255], now);
+    }
+};
+
+struct EstimateSpeedSnapshot {
+    static const char* name() { return "SpeedEstimator::estimateSpeed(EncoderSnapshot)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimator> estimators;
+    vector<EncoderSnapshot> snapshots;
+    explicit EstimateSpeedSnapshot(size_t n) : estimators(n, SpeedEstimator(PPR, GEAR_RATIO)), snapshots(n) {}
+    float call(size_t k, uint32_t i) {
+        uint32_t now = traceTime(i);
+        // Includes publishing the sample, as the encoder ISR would
+        snapshots[k].write(traceCount(i), now - jitter[i & 255]);
+        return estimators[k].estimateSpeed(snapshots[k], now);
+    }
+};
+
+struct EstimateSpeedBatch {
+    static const char* name() { return "SpeedEstimator::estimateSpeedBatch (per sample)"; }
+    static const bool MANY = false;
+    static const size_t ITEMS_PER_CALL = 256;
+    SpeedEstimator estimator;
+    int32_t counts[ITEMS_PER_CALL];
+    uint32_t timestamps[ITEMS_PER_CALL];
+    float out[ITEMS_PER_CALL];
+    explicit EstimateSpeedBatch(size_t) : estimator(PPR, GEAR_RATIO) {}
+    float call(size_t, uint32_t i) {
+        uint32_t base = i * (uint32_t)ITEMS_PER_CALL;
+        for (size_t s = 0; s < ITEMS_PER_CALL; s++) {
+            counts[s] = traceCount(base + (uint32_t)s);
+            timestamps[s] = traceTime(base + (uint32_t)s);
+        }
+        estimator.estimateSpeedBatch(counts, timestamps, out, ITEMS_PER_CALL);
+        return out[ITEMS_PER_CALL - 1];
+    }
+};
+
+struct EstimateSpeedQ {
+    static const char* name() { return "SpeedEstimatorQ::estimateSpeedQ(int, uint32_t)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimatorQ> estimators;
+    explicit EstimateSpeedQ(size_t n) : estimators(n, SpeedEstimatorQ(PPR, GEAR_RATIO)) {}
+    float call(size_t k, uint32_t i) { return (float)estimators[k].estimateSpeedQ(traceCount(i), traceTime(i)); }
+};
+
+struct EstimateSpeedT {
+    static const char* name() { return "SpeedEstimatorT::estimateSpeed(int)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimatorT<22, 93, 10, 10000> > estimators;
+    explicit EstimateSpeedT(size_t n) : estimators(n) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i)); }
+};
+
+struct EstimateSpeedTTimestamp {
+    static const char* name() { return "SpeedEstimatorT::estimateSpeed(int, uint32_t)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<SpeedEstimatorT<22, 93, 10, 10000> > estimators;
+    explicit EstimateSpeedTTimestamp(size_t n) : estimators(n) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct KalmanEstimateSpeed {
+    static const char* name() { return "KalmanSpeedEstimator::estimateSpeed(int, uint32_t)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<KalmanSpeedEstimator> estimators;
+    explicit KalmanEstimateSpeed(size_t n) : estimators(n, KalmanSpeedEstimator(PPR, GEAR_RATIO, 1.0e4f)) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct KalmanAccelerationEstimateSpeed {
+    static const char* name() { return "KalmanSpeedEstimator::estimateSpeed, acceleration"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<KalmanSpeedEstimator> estimators;
+    explicit KalmanAccelerationEstimateSpeed(size_t n)
+        : estimators(n, KalmanSpeedEstimator(PPR, GEAR_RATIO, 1.0e6f, KalmanSpeedEstimator::QUANTIZATION_NOISE, true)) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct AlphaBetaEstimateSpeed {
+    static const char* name() { return "AlphaBetaEstimator::estimateSpeed(int)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<AlphaBetaEstimator> estimators;
+    explicit AlphaBetaEstimateSpeed(size_t n)
+        : estimators(n, AlphaBetaEstimator(PPR, GEAR_RATIO, 10000, TrackingGains{0.3f, 0.05f, 0.002f})) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i)); }
+};
+
+struct AlphaBetaEstimateSpeedQ {
+    static const char* name() { return "AlphaBetaEstimatorQ::estimateSpeedQ(int)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<AlphaBetaEstimatorQ> estimators;
+    explicit AlphaBetaEstimateSpeedQ(size_t n)
+        : estimators(n, AlphaBetaEstimatorQ(PPR, GEAR_RATIO, 10000, TrackingGains{0.3f, 0.05f, 0.002f})) {}
+    float call(size_t k, uint32_t i) { return (float)estimators[k].estimateSpeedQ(traceCount(i)); }
+};
+
+struct ObserverEstimateSpeed {
+    static const char* name() { return "TrackingObserverEstimator::estimateSpeed(int, uint32_t)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<TrackingObserverEstimator> estimators;
+    explicit ObserverEstimateSpeed(size_t n) : estimators(n, TrackingObserverEstimator(PPR, GEAR_RATIO, 2.0f)) {}
+    float call(size_t k, uint32_t i) { return estimators[k].estimateSpeed(traceCount(i), traceTime(i)); }
+};
+
+struct BankUpdate {
+    static const char* name() { return "SpeedEstimatorBank<8>::update (per channel)"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 8;
+    vector<SpeedEstimatorBank<8> > banks;
+    explicit BankUpdate(size_t n) : banks(n) {
+        for (size_t k = 0; k < n; k++) {
+            banks[k].configureAll(PPR, GEAR_RATIO);
+        }
+    }
+    float call(size_t k, uint32_t i) {
+        int32_t counts[8];
+        for (int c = 0; c < 8; c++) {
+            counts[c] = traceCount(i) * (c + 1);
+        }
+        banks[k].update(counts, traceTime(i));
+        return banks[k].speed(7);
+    }
+};
+
+struct SimdBankUpdate {
+    static const char* name() { return "SimdSpeedBank::update, 1024 channels (per channel)"; }
+    static const bool MANY = false;
+    static const size_t ITEMS_PER_CALL = 1024;
+    SimdSpeedBank bank;
+    vector<int32_t> counts;
+    explicit SimdBankUpdate(size_t) : bank(ITEMS_PER_CALL), counts(ITEMS_PER_CALL) { bank.configureAll(PPR, GEAR_RATIO); }
+    float call(size_t, uint32_t i) {
+        for (size_t c = 0; c < ITEMS_PER_CALL; c++) {
+            counts[c] += (int32_t)(c & 15) + noise[i & 255];
+        }
+        bank.update(counts.data(), traceTime(i));
+        return bank.speed(ITEMS_PER_CALL - 1);
+    }
+};
+
+struct FilterUpdate {
+    static const char* name() { return "IIRFilter::update, first order"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<IIRFilter> filters;
+    explicit FilterUpdate(size_t n) : filters(n) {}
+    float call(size_t k, uint32_t i) { return filters[k].update((float)noise[i & 255]); }
+};
+
+struct FilterUpdate2 {
+    static const char* name() { return "IIRFilter::update, butterworth2"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<IIRFilter> filters;
+    explicit FilterUpdate2(size_t n) : filters(n, IIRFilter::butterworth2(5.0f, 0.01f)) {}
+    float call(size_t k, uint32_t i) { return filters[k].update((float)noise[i & 255]); }
+};
+
+struct FilterProcess {
+    static const char* name() { return "IIRFilter::process (per sample)"; }
+    static const bool MANY = false;
+    static const size_t ITEMS_PER_CALL = 256;
+    IIRFilter filter;
+    float data[ITEMS_PER_CALL];
+    explicit FilterProcess(size_t) {}
+    float call(size_t, uint32_t i) {
+        for (size_t s = 0; s < ITEMS_PER_CALL; s++) {
+            data[s] = (float)noise[(i + s) & 255];
+        }
+        filter.process(data, ITEMS_PER_CALL);
+        return data[ITEMS_PER_CALL - 1];
+    }
+};
+
+struct ParallelFilterProcess {
+    static const char* name() { return "ParallelScanFilter::process, 1M samples (per sample)"; }
+    static const bool MANY = false;
+    static const size_t ITEMS_PER_CALL = 1 << 20;
+    ParallelScanFilter filter;
+    vector<float> data;
+    explicit ParallelFilterProcess(size_t) : filter(0.1367f, 0.1367f, 0.0f, -0.7265f, 0.0f), data(ITEMS_PER_CALL) {}
+    float call(size_t, uint32_t i) {
+        for (size_t s = 0; s < ITEMS_PER_CALL; s++) {
+            data[s] = (float)noise[(i + s) & 255];
+        }
+        filter.process(data.data(), ITEMS_PER_CALL);
+        return data[ITEMS_PER_CALL - 1];
+    }
+};
+
+struct DecoderUpdate {
+    static const char* name() { return "QuadratureDecoder::update, 4x"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<QuadratureDecoder> decoders;
+    explicit DecoderUpdate(size_t n) : decoders(n, QuadratureDecoder(2, 3, QUADRATURE_4X)) {
+        for (size_t k = 0; k < n; k++) {
+            decoders[k].begin();
+        }
+    }
+    float call(size_t k, uint32_t i) {
+        // Pins 2 (A) and 3 (B) follow the forward Gray sequence
+        static const uint32_t GRAY[4] = {0x0, 0x4, 0xC, 0x8};
+        hostInputPort = GRAY[i & 3];
+        return (float)decoders[k].update();
+    }
+};
+
+struct SnapshotIncrementRead {
+    static const char* name() { return "EncoderSnapshot::increment + read"; }
+    static const bool MANY = true;
+    static const size_t ITEMS_PER_CALL = 1;
+    vector<EncoderSnapshot> snapshots;
+    explicit SnapshotIncrementRead(size_t n) : snapshots(n) {}
+    float call(size_t k, uint32_t i) {
+        int32_t count;
+        uint32_t timestamp;
+        snapshots[k].increment(1, i);
+        snapshots[k].read(count, timestamp);
+        return (float)count;
+    }
+};
+
+// ============================================================================
+// Harness
+// ============================================================================
+static double median(vector<double> values) {
+    sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+/**
+ * @brief Walk a buffer larger than the last-level cache, evicting the benchmark state.
+ */
+static void flushCaches() {
+    static vector<uint8_t> buffer(64UL << 20, 1);
+    unsigned sum = 0;
+    for (size_t i = 0; i < buffer.size(); i += 64) {
+        sum += buffer[i];
+        buffer[i] = (uint8_t)sum;
+    }
+    sink = (float)sum;
+}
+
+/**
+ * @brief Cost of reading the clock twice, subtracted from the cold measurements.
+ */
+static double timerOverheadNs() {
+    vector<double> samples;
+    for (int r = 0; r < 1000; r++) {
+        Clock::time_point start = Clock::now();
+        Clock::time_point end = Clock::now();
+        samples.push_back(chrono::duration<double, nano>(end - start).count());
+    }
+    return median(samples);
+}
+
+template <class Bench>
+static double measureWarm(size_t instances, size_t calls) {
+    Bench bench(instances);
+    float acc = 0;
+    uint32_t i = 1;
+    // Warm-up: touch every instance and settle the branch predictors
+    for (size_t c = 0; c < instances * 2 + 1000 / Bench::ITEMS_PER_CALL; c++, i++) {
+        acc += bench.call(c % instances, i);
+    }
+
+    vector<double> repeats;
+    for (int r = 0; r < 5; r++) {
+        size_t k = 0;
+        Clock::time_point start = Clock::now();
+        for (size_t c = 0; c < calls; c++, i++) {
+            acc += bench.call(k, i);
+            if (++k == instances) {
+                k = 0;
+            }
+        }
+        Clock::time_point end = Clock::now();
+        repeats.push_back(chrono::duration<double, nano>(end - start).count() / (double)calls);
+    }
+    sink = acc;
+    return median(repeats);
+}
+
+template <class Bench>
+static double measureCold(size_t calls, double overheadNs) {
+    Bench bench(1);
+    float acc = 0;
+    vector<double> samples;
+    for (uint32_t i = 1; i <= calls; i++) {
+        flushCaches();
+        Clock::time_point start = Clock::now();
+        acc += bench.call(0, i);
+        Clock::time_point end = Clock::now();
+        samples.push_back(chrono::duration<double, nano>(end - start).count() - overheadNs);
+    }
+    sink = acc;
+    double result = median(samples);
+    return (result > 0) ? result : 0;
+}
+
+template <class Bench>
+static void run(const Options& options, double overheadNs, vector<Result>& results) {
+    const char* name = Bench::name();
+    if (options.filter != nullptr && strstr(name, options.filter) == nullptr) {
+        return;
+    }
+
+    // About 20 ms per warm repeat in full mode
+    size_t items = options.quick ? 200000 : 4000000;
+    size_t calls = items / Bench::ITEMS_PER_CALL;
+    if (calls < 3) {
+        calls = 3;
+    }
+    size_t coldCalls = options.quick ? 20 : 100;
+    if (Bench::ITEMS_PER_CALL > 10000) {
+        coldCalls = 3;
+    }
+
+    vector<Result> measured;
+    measured.push_back(Result{name, "warm_single", measureWarm<Bench>(1, calls), calls});
+    if (Bench::MANY) {
+        measured.push_back(Result{name, "warm_many", measureWarm<Bench>(MANY_INSTANCES, calls), calls});
+    }
+    measured.push_back(Result{name, "cold_single", measureCold<Bench>(coldCalls, overheadNs), coldCalls});
+
+    for (size_t r = 0; r < measured.size(); r++) {
+        measured[r].nsPerCall /= (double)Bench::ITEMS_PER_CALL;
+        printf("%-58s %-12s %10.2f ns %14.0f calls/s\n", name, measured[r].variant.c_str(), measured[r].nsPerCall,
+               1e9 / measured[r].nsPerCall);
+        results.push_back(measured[r]);
+    }
+}
+
+static bool writeJson(const char* path, const vector<Result>& results) {
+    FILE* file = fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "{\n  \"context\": {\"compiler\": \"%s\", \"many_instances\": %zu},\n", __VERSION__, MANY_INSTANCES);
+    fprintf(file, "  \"benchmarks\": [\n");
+    for (size_t r = 0; r < results.size(); r++) {
+        fprintf(file, "    {\"name\": \"%s\", \"variant\": \"%s\", \"ns_per_call\": %.3f, \"calls_per_second\": %.0f, \"calls\": %zu}%s\n",
+                results[r].name.c_str(), results[r].variant.c_str(), results[r].nsPerCall, 1e9 / results[r].nsPerCall,
+                results[r].calls, (r + 1 < results.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "--json") == 0 && a + 1 < argc) {
+            options.jsonPath = argv[++a];
+        } else if (strcmp(argv[a], "--filter") == 0 && a + 1 < argc) {
+            options.filter = argv[++a];
+        } else if (strcmp(argv[a], "--quick") == 0) {
+            options.quick = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--json results.json] [--filter text] [--quick]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    initTrace();
+    double overheadNs = timerOverheadNs();
+    printf("Timer overhead: %.1f ns (subtracted from cold_single)\n\n", overheadNs);
+
+    vector<Result> results;
+    run<EstimateSpeedTimestamp>(options, overheadNs, results);
+    run<EstimateSpeedClock>(options, overheadNs, results);
+    run<EstimateSpeedFixedPeriod>(options, overheadNs, results);
+    run<EstimateSpeedButterworth2>(options, overheadNs, results);
+    run<EstimateSpeedAdaptive>(options, overheadNs, results);
+    run<EstimateSpeedFromPeriod>(options, overheadNs, results);
+    run<EstimateSpeedMT>(options, overheadNs, results);
+    run<EstimateSpeedSnapshot>(options, overheadNs, results);
+    run<EstimateSpeedBatch>(options, overheadNs, results);
+    run<EstimateSpeedQ>(options, overheadNs, results);
+    run<EstimateSpeedT>(options, overheadNs, results);
+    run<EstimateSpeedTTimestamp>(options, overheadNs, results);
+    run<KalmanEstimateSpeed>(options, overheadNs, results);
+    run<KalmanAccelerationEstimateSpeed>(options, overheadNs, results);
+    run<AlphaBetaEstimateSpeed>(options, overheadNs, results);
+    run<AlphaBetaEstimateSpeedQ>(options, overheadNs, results);
+    run<ObserverEstimateSpeed>(options, overheadNs, results);
+    run<BankUpdate>(options, overheadNs, results);
+    run<SimdBankUpdate>(options, overheadNs, results);
+    run<FilterUpdate>(options, overheadNs, results);
+    run<FilterUpdate2>(options, overheadNs, results);
+    run<FilterProcess>(options, overheadNs, results);
+    run<ParallelFilterProcess>(options, overheadNs, results);
+    run<DecoderUpdate>(options, overheadNs, results);
+    run<SnapshotIncrementRead>(options, overheadNs, results);
+
+    if (options.jsonPath != nullptr) {
+        if (!writeJson(options.jsonPath, results)) {
+            fprintf(stderr, "Cannot write %s\n", options.jsonPath);
+            return 1;
+        }
+        printf("\nResults written to %s\n", options.jsonPath);
+    }
+    return 0;
+}
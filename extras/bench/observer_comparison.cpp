@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file observer_comparison.cpp
+ * @brief Lag and noise of the tracking observer against the low-pass filtered estimator.
+ *
+ * Each estimator is run on simulated encoder traces sampled at a fixed period:
+ * - noise: RMS deviation from the true speed at a constant 313.7 RPM, once settled.
+ *   The counts are quantized, and each encoder line is misplaced by up to 0.2 counts
+ *   (a fixed pattern per line, as from a disc with uneven slots).
+ * - lag: mean error during a 1000 RPM/s ramp divided by the slope, in milliseconds.
+ *
+ * The first table sweeps the tuning of each estimator. The second one matches the
+ * noise: for each cutoff of the first-order filter, the observer bandwidth giving the
+ * same noise is searched, and the lags are compared.
+ *
+ * Built by the CMake host build:
+ *   observer_comparison
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "SpeedEstimator.h"
+#include "TrackingEstimator.h"
+
+using namespace std;
+
+static const float PPR = 22.0f;
+static const float GEAR_RATIO = 9.3f;
+static const double COUNTS_PER_REV = 22.0 * 9.3;
+static const int LINES = 205; ///< Encoder lines with a placement error (about one revolution).
+static const double LINE_ERROR = 0.2; ///< Largest line placement error in counts.
+
+static const double NOISE_SPEED = 313.7; ///< RPM of the noise trace.
+static const double RAMP_SLOPE = 1000.0; ///< RPM/s of the lag trace.
+
+/**
+ * @brief Sampled encoder trace with the true speed at each sample.
+ */
+struct Trace {
+    vector<int> counts;
+    vector<double> speeds;
+    size_t first; ///< First sample of the measurement window.
+};
+
+/**
+ * @brief Metrics of one estimator.
+ */
+struct Metrics {
+    double noiseRpm;
+    double lagMs;
+};
+
+static double lineError[LINES];
+
+static void initLineErrors() {
+    uint32_t seed = 12345;
+    for (int i = 0; i < LINES; i++) {
+        seed = seed * 1103515245UL + 12345UL;
+        lineError[i] = LINE_ERROR * (2.0 * (double)((seed >> 8) % 10001) / 10000.0 - 1.0);
+    }
+}
+
+/**
+ * @brief Counts of an encoder following a speed profile, read every periodMicros.
+ */
+static Trace makeTrace(double (*rpm)(double t), double seconds, double settleSeconds, uint32_t periodMicros) {
+    Trace trace;
+    double dt = periodMicros * 1e-6;
+    size_t n = (size_t)(seconds / dt);
+    double position = 0.5;
+    for (size_t i = 0; i < n; i++) {
+        double t = (double)i * dt;
+        // The count changes when the position crosses the (misplaced) next line
+        int count = (int)floor(position);
+        int line = ((count % LINES) + LINES) % LINES;
+        if (position - count < lineError[line]) {
+            count--;
+        }
+        trace.counts.push_back(count);
+        trace.speeds.push_back(rpm(t));
+        position += 0.5 * (rpm(t) + rpm(t + dt)) / 60.0 * COUNTS_PER_REV * dt;
+    }
+    trace.first = (size_t)(settleSeconds / dt);
+    return trace;
+}
+
+static double constantSpeed(double) { return NOISE_SPEED; }
+
+// 0.5 s at rest, then the ramp
+static double rampSpeed(double t) { return (t < 0.5) ? 0.0 : (t - 0.5) * RAMP_SLOPE; }
+
+/**
+ * @brief Run a fresh estimator over a trace.
+ * @return Errors against the true speed in the measurement window.
+ */
+template <class Make>
+static vector<double> run(const Make& make, const Trace& trace, uint32_t periodMicros) {
+    auto estimator = make();
+    vector<double> errors;
+    uint32_t time = 0;
+    for (size_t i = 0; i < trace.counts.size(); i++) {
+        time += periodMicros;
+        float speed = estimator.update(trace.counts[i], time);
+        if (i >= trace.first) {
+            errors.push_back(speed - trace.speeds[i]);
+        }
+    }
+    return errors;
+}
+
+template <class Make>
+static Metrics evaluate(const Make& make, uint32_t periodMicros) {
+    static Trace noiseTrace, rampTrace;
+    static uint32_t tracePeriod = 0;
+    if (tracePeriod != periodMicros) {
+        noiseTrace = makeTrace(constantSpeed, 10.0, 4.0, periodMicros);
+        rampTrace = makeTrace(rampSpeed, 3.5, 2.0, periodMicros);
+        tracePeriod = periodMicros;
+    }
+
+    Metrics metrics;
+    vector<double> errors = run(make, noiseTrace, periodMicros);
+    double mean = 0, variance = 0;
+    for (double e : errors) {
+        mean += e;
+    }
+    mean /= (double)errors.size();
+    for (double e : errors) {
+        variance += (e - mean) * (e - mean);
+    }
+    metrics.noiseRpm = sqrt(variance / (double)errors.size());
+
+    errors = run(make, rampTrace, periodMicros);
+    mean = 0;
+    for (double e : errors) {
+        mean += e;
+    }
+    metrics.lagMs = -mean / (double)errors.size() / RAMP_SLOPE * 1e3;
+    return metrics;
+}
+
+// ============================================================================
+// Estimators under test, with a common update(count, time)
+// ============================================================================
+struct FilterEstimator {
+    SpeedEstimator estimator;
+    FilterEstimator(const IIRFilter& filter, uint32_t periodMicros) : estimator(PPR, GEAR_RATIO, filter) {
+        estimator.setFixedPeriod(periodMicros);
+    }
+    float update(int count, uint32_t) { return estimator.estimateSpeed(count); }
+};
+
+struct ObserverEstimator {
+    TrackingObserverEstimator estimator;
+    explicit ObserverEstimator(float bandwidthHz) : estimator(PPR, GEAR_RATIO, bandwidthHz) {}
+    float update(int count, uint32_t time) { return estimator.estimateSpeed(count, time); }
+};
+
+struct ObserverEstimatorQ {
+    TrackingObserverEstimatorQ estimator;
+    ObserverEstimatorQ(float bandwidthHz, uint32_t periodMicros)
+        : estimator(PPR, GEAR_RATIO, periodMicros, bandwidthHz) {}
+    float update(int count, uint32_t) { return estimator.estimateSpeed(count); }
+};
+
+static Metrics evaluateFilter1(float cutoffHz, uint32_t periodMicros) {
+    return evaluate([=]() { return FilterEstimator(IIRFilter::butterworth1(cutoffHz, periodMicros * 1e-6f),
+                                                   periodMicros); }, periodMicros);
+}
+
+static Metrics evaluateFilter2(float cutoffHz, uint32_t periodMicros) {
+    return evaluate([=]() { return FilterEstimator(IIRFilter::butterworth2(cutoffHz, periodMicros * 1e-6f),
+                                                   periodMicros); }, periodMicros);
+}
+
+static Metrics evaluateObserver(float bandwidthHz, uint32_t periodMicros) {
+    return evaluate([=]() { return ObserverEstimator(bandwidthHz); }, periodMicros);
+}
+
+static Metrics evaluateObserverQ(float bandwidthHz, uint32_t periodMicros) {
+    return evaluate([=]() { return ObserverEstimatorQ(bandwidthHz, periodMicros); }, periodMicros);
+}
+
+static void printRow(const char* name, float hz, const Metrics& m) {
+    printf("%-34s %8.2f %12.3f %10.2f\n", name, hz, m.noiseRpm, m.lagMs);
+}
+
+static void compare(uint32_t periodMicros) {
+    float sampleRate = 1e6f / (float)periodMicros;
+    printf("\n=== Sample period %u us ===\n\n", (unsigned)periodMicros);
+    printf("%-34s %8s %12s %10s\n", "Estimator", "Hz", "Noise (RPM)", "Lag (ms)");
+
+    const float settings[] = {1.0f, 2.0f, 5.0f, 10.0f, 20.0f, 50.0f};
+    for (float hz : settings) {
+        if (hz > 0.1f * sampleRate) {
+            break;
+        }
+        printRow("SpeedEstimator, butterworth1", hz, evaluateFilter1(hz, periodMicros));
+        printRow("SpeedEstimator, butterworth2", hz, evaluateFilter2(hz, periodMicros));
+        printRow("TrackingObserverEstimator", hz, evaluateObserver(hz, periodMicros));
+        printRow("TrackingObserverEstimatorQ", hz, evaluateObserverQ(hz, periodMicros));
+    }
+
+    printf("\nSame noise as butterworth1:\n");
+    printf("%8s %12s %14s %14s %16s\n", "Cutoff", "Noise (RPM)", "Filter lag", "Observer Hz", "Observer lag");
+    for (float hz : settings) {
+        if (hz > 0.1f * sampleRate) {
+            break;
+        }
+        Metrics filter = evaluateFilter1(hz, periodMicros);
+
+        // The noise grows with the bandwidth: bisection on a log scale, up to the
+        // recommended tenth of the sample rate
+        const float limit = 0.1f * sampleRate;
+        float low = 0.05f, high = limit;
+        for (int step = 0; step < 30; step++) {
+            float middle = sqrtf(low * high);
+            if (evaluateObserver(middle, periodMicros).noiseRpm < filter.noiseRpm) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        Metrics observer = evaluateObserver(low, periodMicros);
+        printf("%8.2f %12.3f %11.2f ms %14.2f %13.2f ms%s\n", hz, filter.noiseRpm, filter.lagMs, low, observer.lagMs,
+               (low > 0.99f * limit) ? " (bandwidth limit, less noise)" : "");
+    }
+}
+
+int main() {
+    initLineErrors();
+    printf("Encoder: %.1f counts/rev, line placement error up to %.2f counts\n", COUNTS_PER_REV, LINE_ERROR);
+    printf("Noise at %.1f RPM, lag on a %.0f RPM/s ramp\n", NOISE_SPEED, RAMP_SLOPE);
+    compare(1000);
+    compare(10000);
+    return 0;
+}
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file Arduino.cpp
+ * @brief Implementation of the host Arduino shim.
+ */
+
+#include "Arduino.h"
+
+volatile uint32_t hostInputPort = 0;
+
+namespace {
+
+uint32_t currentMicros = 0;
+
+struct AttachedInterrupt {
+    void (*isr)();
+    int mode;
+};
+
+AttachedInterrupt attachedInterrupts[HOST_NUM_PINS] = {};
+
+} // namespace
+
+unsigned long micros() { return currentMicros; }
+
+unsigned long millis() { return currentMicros / 1000UL; }
+
+void delay(unsigned long ms) { hostAdvanceMicros((uint32_t)(ms * 1000UL)); }
+
+void delayMicroseconds(unsigned int us) { hostAdvanceMicros(us); }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (mode == INPUT_PULLUP) {
+        hostSetPin(pin, HIGH);
+    }
+}
+
+int digitalRead(uint8_t pin) { return (hostInputPort & digitalPinToBitMask(pin)) ? HIGH : LOW; }
+
+void digitalWrite(uint8_t pin, uint8_t value) { hostSetPin(pin, value); }
+
+void attachInterrupt(uint8_t interruptNum, void (*isr)(), int mode) {
+    if (interruptNum < HOST_NUM_PINS) {
+        attachedInterrupts[interruptNum].isr = isr;
+        attachedInterrupts[interruptNum].mode = mode;
+    }
+}
+
+void detachInterrupt(uint8_t interruptNum) {
+    if (interruptNum < HOST_NUM_PINS) {
+        attachedInterrupts[interruptNum].isr = nullptr;
+    }
+}
+
+void hostSetMicros(uint32_t timestampMicros) { currentMicros = timestampMicros; }
+
+void hostAdvanceMicros(uint32_t deltaMicros) { currentMicros += deltaMicros; }
+
+void hostSetPin(uint8_t pin, uint8_t level) {
+    if (pin >= HOST_NUM_PINS) {
+        return;
+    }
+    int previous = digitalRead(pin);
+    if (level) {
+        hostInputPort |= digitalPinToBitMask(pin);
+    } else {
+        hostInputPort &= ~digitalPinToBitMask(pin);
+    }
+
+    const AttachedInterrupt& attached = attachedInterrupts[pin];
+    if (attached.isr == nullptr || previous == (level ? HIGH : LOW)) {
+        return;
+    }
+    if (attached.mode == CHANGE || (attached.mode == RISING && level) || (attached.mode == FALLING && !level)) {
+        attached.isr();
+    }
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file Arduino.h
+ * @brief Minimal Arduino API for building the library on a desktop host (tests, benchmarks, profiling).
+ *
+ * Only what the library sources use is provided. Time does not run by itself:
+ * micros() returns a value set by the test (hostSetMicros(), hostAdvanceMicros()),
+ * so runs are reproducible. Pins are bits of one simulated input port, and
+ * hostSetPin() runs the ISR attached to a pin when the level change matches its mode.
+ *
+ * Used by the CMake build only; the Arduino IDE uses the real core.
+ */
+
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#define LOW 0
+#define HIGH 1
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define HOST_NUM_PINS 32 ///< Pins 0..31, one bit each in the simulated port.
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+void attachInterrupt(uint8_t interruptNum, void (*isr)(), int mode);
+void detachInterrupt(uint8_t interruptNum);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+extern volatile uint32_t hostInputPort; ///< Simulated input register holding all pin levels.
+
+#define digitalPinToInterrupt(pin) (pin)
+#define digitalPinToPort(pin) (0)
+#define digitalPinToBitMask(pin) (1UL << (pin))
+#define portInputRegister(port) (&hostInputPort)
+
+/**
+ * @brief Set the value returned by micros().
+ */
+void hostSetMicros(uint32_t timestampMicros);
+
+/**
+ * @brief Advance the value returned by micros() (wraps at 2^32 like the real counter).
+ */
+void hostAdvanceMicros(uint32_t deltaMicros);
+
+/**
+ * @brief Drive a pin level, running its attached ISR on a matching edge.
+ */
+void hostSetPin(uint8_t pin, uint8_t level);
+
+#endif
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file ParallelScanFilter.cpp
+ * @brief Implementation of the ParallelScanFilter class.
+ */
+
+#include "ParallelScanFilter.h"
+
+#include <cfloat>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Filter state: previous inputs and outputs.
+ */
+struct FilterState {
+    float x1, x2, y1, y2;
+};
+
+/**
+ * @brief Filter data[begin, end) in place, same loop as IIRFilter::process().
+ */
+void filterChunk(float* data, size_t begin, size_t end, const float* coeffs, FilterState* state) {
+    const float b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2], a1 = coeffs[3], a2 = coeffs[4];
+    float x1 = state->x1, x2 = state->x2, y1 = state->y1, y2 = state->y2;
+    for (size_t i = begin; i < end; i++) {
+        float x = data[i];
+        float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        data[i] = y;
+    }
+    state->x1 = x1;
+    state->x2 = x2;
+    state->y1 = y1;
+    state->y2 = y2;
+}
+
+} // namespace
+
+ParallelScanFilter::ParallelScanFilter(float b0, float b1, float b2, float a1, float a2, unsigned threads)
+    : mB0(b0), mB1(b1), mB2(b2), mA1(a1), mA2(a2), mThreads(threads) {
+    if (mThreads == 0) {
+        mThreads = std::thread::hardware_concurrency();
+        if (mThreads == 0) {
+            mThreads = 1;
+        }
+    }
+    reset();
+}
+
+void ParallelScanFilter::computeResponses(size_t maxLength) {
+    mH1.clear();
+    mH2.clear();
+
+    // Stop once both responses are far below the float resolution of the initial state
+    const float threshold = FLT_EPSILON * FLT_EPSILON;
+    float h1Prev1 = 1, h1Prev2 = 0; // y[-1] = 1
+    float h2Prev1 = 0, h2Prev2 = 1; // y[-2] = 1
+    for (size_t i = 0; i < maxLength; i++) {
+        float h1 = -mA1 * h1Prev1 - mA2 * h1Prev2;
+        float h2 = -mA1 * h2Prev1 - mA2 * h2Prev2;
+        mH1.push_back(h1);
+        mH2.push_back(h2);
+        if (std::fabs(h1) + std::fabs(h1Prev1) + std::fabs(h2) + std::fabs(h2Prev1) < threshold) {
+            break;
+        }
+        h1Prev2 = h1Prev1;
+        h1Prev1 = h1;
+        h2Prev2 = h2Prev1;
+        h2Prev1 = h2;
+    }
+}
+
+void ParallelScanFilter::process(float* data, size_t n) {
+    const float coeffs[5] = {mB0, mB1, mB2, mA1, mA2};
+    FilterState state = {mX1, mX2, mY1, mY2};
+
+    size_t chunks = n / MIN_CHUNK;
+    if (chunks > mThreads) {
+        chunks = mThreads;
+    }
+    if (chunks < 2) {
+        filterChunk(data, 0, n, coeffs, &state);
+        mX1 = state.x1;
+        mX2 = state.x2;
+        mY1 = state.y1;
+        mY2 = state.y2;
+        return;
+    }
+
+    size_t chunkLength = (n + chunks - 1) / chunks;
+    computeResponses(chunkLength);
+
+    // Initial state of each chunk: inputs saved before the workers overwrite them, zero
+    // outputs (the first chunk starts from the real state)
+    std::vector<FilterState> states(chunks);
+    states[0] = state;
+    for (size_t c = 1; c < chunks; c++) {
+        states[c].x1 = data[c * chunkLength - 1];
+        states[c].x2 = data[c * chunkLength - 2];
+        states[c].y1 = 0;
+        states[c].y2 = 0;
+    }
+    float lastX1 = data[n - 1];
+    float lastX2 = data[n - 2];
+
+    // Pass 1: all chunks in parallel
+    std::vector<std::thread> workers;
+    for (size_t c = 0; c < chunks; c++) {
+        size_t begin = c * chunkLength;
+        size_t end = (begin + chunkLength < n) ? begin + chunkLength : n;
+        workers.push_back(std::thread(filterChunk, data, begin, end, coeffs, &states[c]));
+    }
+    for (size_t c = 0; c < workers.size(); c++) {
+        workers[c].join();
+    }
+
+    // Pass 2: in order, add the response to the final outputs of the previous chunk
+    for (size_t c = 1; c < chunks; c++) {
+        size_t begin = c * chunkLength;
+        size_t end = (begin + chunkLength < n) ? begin + chunkLength : n;
+        float y1 = data[begin - 1];
+        float y2 = data[begin - 2];
+        size_t length = (end - begin < mH1.size()) ? end - begin : mH1.size();
+        for (size_t i = 0; i < length; i++) {
+            data[begin + i] += y1 * mH1[i] + y2 * mH2[i];
+        }
+    }
+
+    mX1 = lastX1;
+    mX2 = lastX2;
+    mY1 = data[n - 1];
+    mY2 = data[n - 2];
+}
+
+void ParallelScanFilter::reset() {
+    mX1 = mX2 = 0;
+    mY1 = mY2 = 0;
+}
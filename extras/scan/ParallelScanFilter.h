@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file ParallelScanFilter.h
+ * @brief Host-only multithreaded evaluation of the speed filter over one long trace.
+ *
+ * The IIR filter is a linear recurrence, y[n] = f[n] - a1 * y[n-1] - a2 * y[n-2],
+ * so each output depends on all the previous ones. It is still an affine map of the
+ * state at the start of a chunk:
+ *
+ *     y[n] = p[n] + y[-1] * h1[n] + y[-2] * h2[n]
+ *
+ * where p is the chunk filtered from a zero state and h1, h2 are the responses to a
+ * unit initial state (the same for every chunk). The trace is split in one chunk per
+ * thread, every chunk is filtered in parallel from a zero state, and the chunks are
+ * then fixed up in order with the final state of the previous one.
+ *
+ * For a stable filter h1 and h2 decay geometrically, so only the first samples of
+ * each chunk need the fix-up (until the responses fall below float resolution): the
+ * sequential part is a few hundred samples per chunk, whatever the trace length.
+ * Results match sequential processing within float rounding.
+ *
+ * Not part of the Arduino library: build it on the host, e.g.
+ * g++ -O2 -std=c++11 -pthread ParallelScanFilter.cpp ...
+ */
+
+#ifndef __PARALLELSCANFILTER_H__
+#define __PARALLELSCANFILTER_H__
+
+#include <stddef.h>
+#include <vector>
+
+/**
+ * @class ParallelScanFilter
+ * @brief Second-order IIR filter (same difference equation as IIRFilter) evaluated in parallel chunks.
+ *
+ * Example usage:
+ * @code
+ * // Raw velocities of a recorded trace, computed per sample (no loop-carried state)
+ * ParallelScanFilter filter(0.1367f, 0.1367f, 0.0f, -0.7265f, 0.0f);
+ * filter.process(velocities.data(), velocities.size()); // In place, all cores
+ * @endcode
+ */
+class ParallelScanFilter {
+    private:
+        float mB0, mB1, mB2, mA1, mA2; ///< Filter coefficients (a0 normalized to 1).
+        float mX1, mX2; ///< Previous inputs.
+        float mY1, mY2; ///< Previous outputs.
+        unsigned mThreads; ///< Number of worker threads.
+
+        std::vector<float> mH1; ///< Zero-input response to y[-1] = 1.
+        std::vector<float> mH2; ///< Zero-input response to y[-2] = 1.
+
+        /**
+         * @brief Compute the unit initial state responses, up to their decay or maxLength samples.
+         */
+        void computeResponses(size_t maxLength);
+
+    public:
+        /**
+         * @brief Minimum chunk length: shorter traces are filtered sequentially.
+         */
+        static const size_t MIN_CHUNK = 4096;
+
+        /**
+         * @brief Constructor for ParallelScanFilter.
+         * @param b0 Feed-forward coefficient b0 (e.g. IIRFilter::b0()).
+         * @param b1 Feed-forward coefficient b1.
+         * @param b2 Feed-forward coefficient b2.
+         * @param a1 Feedback coefficient a1.
+         * @param a2 Feedback coefficient a2.
+         * @param threads Number of worker threads, 0 for one per hardware thread.
+         */
+        ParallelScanFilter(float b0, float b1, float b2, float a1, float a2, unsigned threads = 0);
+
+        /**
+         * @brief Filter a block of samples in place.
+         * @param data Input samples, replaced by the filtered output.
+         * @param n Number of samples.
+         * @note The state is carried over, so a trace can be fed in blocks.
+         */
+        void process(float* data, size_t n);
+
+        /**
+         * @brief Last filtered output.
+         */
+        float output() const { return mY1; }
+
+        /**
+         * @brief Clear the filter state.
+         */
+        void reset();
+
+        unsigned threads() const { return mThreads; }
+};
+
+#endif
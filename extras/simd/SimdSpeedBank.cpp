@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SimdSpeedBank.cpp
+ * @brief Implementation of the SimdSpeedBank class and its scalar, SSE2 and AVX2 kernels.
+ */
+
+#include "SimdSpeedBank.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMDSPEEDBANK_X86 1
+#include <immintrin.h>
+#endif
+
+// Contracting a * b + c into an FMA would change the rounding of the scalar path
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace {
+
+/**
+ * @brief Kernel arguments: per-channel arrays and the values shared by all channels.
+ */
+struct KernelArgs {
+    const int32_t* counts;
+    int32_t* prevCounts;
+    const float* rpmScale;
+    float* speedFilt;
+    float* speedPrev;
+    float deltaTime;
+    float b0, b1, a1;
+};
+
+void kernelScalar(const KernelArgs& k, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        int32_t pulseDiff = (int32_t)((uint32_t)k.counts[i] - (uint32_t)k.prevCounts[i]);
+        k.prevCounts[i] = k.counts[i];
+
+        // Same expression order as SpeedEstimator::estimateSpeed() and IIRFilter
+        float velocity = ((float)pulseDiff) * k.rpmScale[i] / k.deltaTime;
+        k.speedFilt[i] = k.b0 * velocity + k.b1 * k.speedPrev[i] - k.a1 * k.speedFilt[i];
+        k.speedPrev[i] = velocity;
+    }
+}
+
+#ifdef SIMDSPEEDBANK_X86
+void kernelSse2(const KernelArgs& k, size_t n) {
+    const __m128 deltaTime = _mm_set1_ps(k.deltaTime);
+    const __m128 b0 = _mm_set1_ps(k.b0);
+    const __m128 b1 = _mm_set1_ps(k.b1);
+    const __m128 a1 = _mm_set1_ps(k.a1);
+
+    // Local pointers: the stores below cannot modify them, so they stay in registers
+    const int32_t* countsIn = k.counts;
+    int32_t* prevCountsIo = k.prevCounts;
+    const float* rpmScale = k.rpmScale;
+    float* speedFilt = k.speedFilt;
+    float* speedPrev = k.speedPrev;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i counts = _mm_loadu_si128((const __m128i*)(countsIn + i));
+        __m128i prevCounts = _mm_loadu_si128((const __m128i*)(prevCountsIo + i));
+        _mm_storeu_si128((__m128i*)(prevCountsIo + i), counts);
+
+        __m128 pulseDiff = _mm_cvtepi32_ps(_mm_sub_epi32(counts, prevCounts));
+        __m128 velocity = _mm_div_ps(_mm_mul_ps(pulseDiff, _mm_loadu_ps(rpmScale + i)), deltaTime);
+
+        __m128 speed = _mm_add_ps(_mm_mul_ps(b0, velocity), _mm_mul_ps(b1, _mm_loadu_ps(speedPrev + i)));
+        speed = _mm_sub_ps(speed, _mm_mul_ps(a1, _mm_loadu_ps(speedFilt + i)));
+        _mm_storeu_ps(speedFilt + i, speed);
+        _mm_storeu_ps(speedPrev + i, velocity);
+    }
+    kernelScalar(k, i, n);
+}
+
+__attribute__((target("avx2")))
+void kernelAvx2(const KernelArgs& k, size_t n) {
+    const __m256 deltaTime = _mm256_set1_ps(k.deltaTime);
+    const __m256 b0 = _mm256_set1_ps(k.b0);
+    const __m256 b1 = _mm256_set1_ps(k.b1);
+    const __m256 a1 = _mm256_set1_ps(k.a1);
+
+    // Local pointers: the stores below cannot modify them, so they stay in registers
+    const int32_t* countsIn = k.counts;
+    int32_t* prevCountsIo = k.prevCounts;
+    const float* rpmScale = k.rpmScale;
+    float* speedFilt = k.speedFilt;
+    float* speedPrev = k.speedPrev;
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i counts = _mm256_loadu_si256((const __m256i*)(countsIn + i));
+        __m256i prevCounts = _mm256_loadu_si256((const __m256i*)(prevCountsIo + i));
+        _mm256_storeu_si256((__m256i*)(prevCountsIo + i), counts);
+
+        __m256 pulseDiff = _mm256_cvtepi32_ps(_mm256_sub_epi32(counts, prevCounts));
+        __m256 velocity = _mm256_div_ps(_mm256_mul_ps(pulseDiff, _mm256_loadu_ps(rpmScale + i)), deltaTime);
+
+        __m256 speed = _mm256_add_ps(_mm256_mul_ps(b0, velocity), _mm256_mul_ps(b1, _mm256_loadu_ps(speedPrev + i)));
+        speed = _mm256_sub_ps(speed, _mm256_mul_ps(a1, _mm256_loadu_ps(speedFilt + i)));
+        _mm256_storeu_ps(speedFilt + i, speed);
+        _mm256_storeu_ps(speedPrev + i, velocity);
+    }
+    // Avoids the AVX to SSE transition penalty in the scalar code that follows
+    _mm256_zeroupper();
+    kernelScalar(k, i, n);
+}
+#endif
+
+} // namespace
+
+SimdSpeedBank::SimdSpeedBank(size_t channels, float b0, float b1, float a1)
+    : mChannels(channels), mPrevTime(0), mPrevCounts(channels, 0), mRpmScale(channels, 0.0f),
+      mSpeedFilt(channels, 0.0f), mSpeedPrev(channels, 0.0f), mB0(b0), mB1(b1), mA1(a1), mIsa(detectIsa()) {
+}
+
+void SimdSpeedBank::configureAll(float ppr, float gearRatio) {
+    for (size_t i = 0; i < mChannels; i++) {
+        configure(i, ppr, gearRatio);
+    }
+}
+
+void SimdSpeedBank::update(const int32_t* counts, uint32_t timestampMicros) {
+    uint32_t deltaTimeMicros = timestampMicros - mPrevTime;
+    if (deltaTimeMicros == 0) {
+        // Avoid division by zero
+        return;
+    }
+    mPrevTime = timestampMicros;
+
+    KernelArgs k;
+    k.counts = counts;
+    k.prevCounts = mPrevCounts.data();
+    k.rpmScale = mRpmScale.data();
+    k.speedFilt = mSpeedFilt.data();
+    k.speedPrev = mSpeedPrev.data();
+    k.deltaTime = (float)deltaTimeMicros;
+    k.b0 = mB0;
+    k.b1 = mB1;
+    k.a1 = mA1;
+
+    switch (mIsa) {
+#ifdef SIMDSPEEDBANK_X86
+        case ISA_AVX2:
+            kernelAvx2(k, mChannels);
+            break;
+        case ISA_SSE2:
+            kernelSse2(k, mChannels);
+            break;
+#endif
+        default:
+            kernelScalar(k, 0, mChannels);
+            break;
+    }
+}
+
+void SimdSpeedBank::reset() {
+    mPrevTime = 0;
+    for (size_t i = 0; i < mChannels; i++) {
+        mPrevCounts[i] = 0;
+        mSpeedFilt[i] = 0;
+        mSpeedPrev[i] = 0;
+    }
+}
+
+SimdSpeedBank::Isa SimdSpeedBank::setIsa(Isa isa) {
+    Isa supported = detectIsa();
+    mIsa = (isa > supported) ? supported : isa;
+    return mIsa;
+}
+
+SimdSpeedBank::Isa SimdSpeedBank::detectIsa() {
+#ifdef SIMDSPEEDBANK_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return ISA_AVX2;
+    }
+    return ISA_SSE2;
+#else
+    return ISA_SCALAR;
+#endif
+}
+
+const char* SimdSpeedBank::isaName(Isa isa) {
+    switch (isa) {
+        case ISA_AVX2:
+            return "avx2";
+        case ISA_SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+}
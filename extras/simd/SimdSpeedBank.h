@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file SimdSpeedBank.h
+ * @brief Host-only multi-channel speed estimator with AVX2/SSE2 kernels (replay of many encoder channels).
+ *
+ * Same computation as SpeedEstimator::estimateSpeed() with a first-order filter, for
+ * thousands of channels sharing one timestamp: difference, scale and IIR run on 8
+ * channels per instruction with AVX2, 4 with SSE2, and a scalar loop elsewhere. The
+ * kernel is selected at run time from the CPU features.
+ *
+ * Every kernel uses the same operations in the same order as SpeedEstimator (division,
+ * no fused multiply-add), so the results are identical in float. SpeedEstimatorBank
+ * multiplies by a shared reciprocal of the elapsed time instead, so it differs from
+ * both by float rounding.
+ *
+ * Not part of the Arduino library: build it on the host, e.g.
+ * g++ -O2 -std=c++11 -I../.. SimdSpeedBank.cpp simd_bank_benchmark.cpp
+ */
+
+#ifndef __SIMDSPEEDBANK_H__
+#define __SIMDSPEEDBANK_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+/**
+ * @class SimdSpeedBank
+ * @brief N speed estimators sharing one timestamp and one first-order filter, vectorized across channels.
+ *
+ * Example usage:
+ * @code
+ * SimdSpeedBank bank(4096);
+ * bank.configureAll(ppr, gearRatio);
+ * bank.update(counts, timestampMicros); // counts: 4096 values
+ * float speed = bank.speed(100);
+ * @endcode
+ */
+class SimdSpeedBank {
+    public:
+        /**
+         * @brief Kernel implementations, from the most portable to the widest.
+         */
+        enum Isa {
+            ISA_SCALAR = 0, ///< Plain C++ loop.
+            ISA_SSE2 = 1, ///< 4 channels per instruction (x86-64 baseline).
+            ISA_AVX2 = 2 ///< 8 channels per instruction.
+        };
+
+    private:
+        size_t mChannels; ///< Number of channels.
+        uint32_t mPrevTime; ///< Previous timestamp in microseconds, shared by all channels.
+        std::vector<int32_t> mPrevCounts; ///< Previous number of pulses per channel.
+        std::vector<float> mRpmScale; ///< RPM * us per pulse per channel: 60e6 / (ppr * gearRatio).
+        std::vector<float> mSpeedFilt; ///< Filtered velocity per channel.
+        std::vector<float> mSpeedPrev; ///< Previous raw velocity per channel.
+
+        float mB0, mB1, mA1; ///< Shared first-order filter coefficients.
+        Isa mIsa; ///< Kernel used by update().
+
+    public:
+        /**
+         * @brief Constructor for SimdSpeedBank.
+         * @param channels Number of channels.
+         * @param b0 Filter coefficient b0 (default: the SpeedEstimator default filter).
+         * @param b1 Filter coefficient b1.
+         * @param a1 Filter coefficient a1.
+         * @note The fastest kernel supported by the CPU is selected.
+         */
+        explicit SimdSpeedBank(size_t channels, float b0 = 0.1367f, float b1 = 0.1367f, float a1 = -0.7265f);
+
+        /**
+         * @brief Set the encoder and gear ratio of one channel.
+         */
+        void configure(size_t channel, float ppr, float gearRatio) {
+            mRpmScale[channel] = 60.0e6f / (ppr * gearRatio);
+        }
+
+        /**
+         * @brief Set the same encoder and gear ratio on all channels.
+         */
+        void configureAll(float ppr, float gearRatio);
+
+        /**
+         * @brief Update all channels from counts sampled at the same time.
+         * @param counts One pulse count per channel.
+         * @param timestampMicros Time in microseconds at which the counts were read.
+         */
+        void update(const int32_t* counts, uint32_t timestampMicros);
+
+        float speed(size_t channel) const { return mSpeedFilt[channel]; }
+        const float* speeds() const { return mSpeedFilt.data(); }
+        size_t size() const { return mChannels; }
+
+        /**
+         * @brief Reset the state of all channels (configuration is kept).
+         */
+        void reset();
+
+        /**
+         * @brief Kernel in use.
+         */
+        Isa isa() const { return mIsa; }
+
+        /**
+         * @brief Force a kernel, e.g. to compare them. Limited to what the CPU supports.
+         * @return The kernel actually selected.
+         */
+        Isa setIsa(Isa isa);
+
+        /**
+         * @brief Widest kernel supported by the CPU running the program.
+         */
+        static Isa detectIsa();
+
+        /**
+         * @brief Kernel name, for reports.
+         */
+        static const char* isaName(Isa isa);
+};
+
+#endif
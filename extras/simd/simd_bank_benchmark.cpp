@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file simd_bank_benchmark.cpp
+ * @brief Channels-per-second throughput of the SimdSpeedBank kernels for growing channel counts.
+ * g++ -O2 -std=c++11 SimdSpeedBank.cpp simd_bank_benchmark.cpp -o simd_bank_benchmark
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "SimdSpeedBank.h"
+
+using namespace std;
+
+/**
+ * @brief Time update() calls over a precomputed count trace.
+ * @return Channel updates per second.
+ */
+static double channelsPerSecond(SimdSpeedBank::Isa isa, size_t channels, float& checksum) {
+    const size_t SAMPLES = 16;
+    vector<int32_t> counts(channels * SAMPLES);
+    srand(1);
+    for (size_t s = 0; s < SAMPLES; s++) {
+        for (size_t c = 0; c < channels; c++) {
+            counts[s * channels + c] = (int32_t)(s * (c % 50)) + rand() % 3;
+        }
+    }
+
+    SimdSpeedBank bank(channels);
+    bank.configureAll(22.0f, 9.3f);
+    bank.setIsa(isa);
+
+    // About 2^25 channel updates per measurement, whatever the bank size
+    size_t updates = (((size_t)1 << 25) / channels) + 1;
+    uint32_t timestamp = 0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t u = 0; u < updates; u++) {
+        timestamp += 10000;
+        bank.update(&counts[(u % SAMPLES) * channels], timestamp);
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    checksum += bank.speed(channels - 1);
+    return (double)(updates * channels) / elapsed.count();
+}
+
+int main() {
+    const size_t CHANNEL_COUNTS[] = {8, 64, 512, 4096, 32768, 262144};
+    SimdSpeedBank::Isa best = SimdSpeedBank::detectIsa();
+    float checksum = 0;
+
+    printf("%10s", "channels");
+    for (int isa = SimdSpeedBank::ISA_SCALAR; isa <= best; isa++) {
+        printf(" %14s", SimdSpeedBank::isaName((SimdSpeedBank::Isa)isa));
+    }
+    printf("   (channel updates per second)\n");
+
+    for (size_t channels : CHANNEL_COUNTS) {
+        printf("%10zu", channels);
+        for (int isa = SimdSpeedBank::ISA_SCALAR; isa <= best; isa++) {
+            printf(" %14.3e", channelsPerSecond((SimdSpeedBank::Isa)isa, channels, checksum));
+        }
+        printf("\n");
+    }
+
+    // Keeps the results alive
+    printf("checksum %g\n", checksum);
+    return 0;
+}
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+# SPDX-License-Identifier: MIT
+# For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+"""Decode the binary telemetry stream of Telemetry.h into CSV.
+
+Reads a capture file, standard input ("-") or a serial port (requires pyserial):
+
+    decode_telemetry.py capture.bin > samples.csv
+    decode_telemetry.py --port /dev/ttyACM0 --baud 500000 > samples.csv
+
+Columns: sequence, timestamp_us, count, raw_rpm, rpm. Frames with a bad CRC and
+frames missing from the sequence are counted and reported on stderr at the end.
+"""
+
+import argparse
+import struct
+import sys
+
+PAYLOAD_SIZE = 17
+RAW_SIZE = PAYLOAD_SIZE + 2
+PAYLOAD = struct.Struct("<BIiff")
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as TelemetryFrame::crc16()."""
+    crc = 0xFFFF
+    for byte in data:
+        x = ((crc >> 8) ^ byte) & 0xFF
+        x ^= x >> 4
+        crc = ((crc << 8) ^ (x << 12) ^ (x << 5) ^ x) & 0xFFFF
+    return crc
+
+
+def cobs_decode(chunk):
+    """Decode a COBS chunk (without the zero delimiter); None if malformed."""
+    out = bytearray()
+    i = 0
+    while i < len(chunk):
+        code = chunk[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(chunk):
+            return None
+        out += chunk[i:i + code - 1]
+        i += code - 1
+        if code < 0xFF and i < len(chunk):
+            out.append(0)
+    return bytes(out)
+
+
+def decode_frame(chunk):
+    """(sequence, timestamp, count, raw_rpm, rpm) of a frame, or None if invalid."""
+    raw = cobs_decode(chunk)
+    if raw is None or len(raw) != RAW_SIZE:
+        return None
+    if crc16(raw[:PAYLOAD_SIZE]) != struct.unpack_from("<H", raw, PAYLOAD_SIZE)[0]:
+        return None
+    return PAYLOAD.unpack_from(raw)
+
+
+class StreamDecoder:
+    """Splits a byte stream at the zero delimiters, as TelemetryDecoder."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.synchronized = False
+        self.last_sequence = None
+        self.frames = 0
+        self.errors = 0
+        self.lost = 0
+
+    def feed(self, data):
+        """Yield the decoded frames completed by data."""
+        for byte in data:
+            if byte != 0:
+                self.buffer.append(byte)
+                continue
+            if self.buffer:
+                frame = decode_frame(bytes(self.buffer))
+                if frame is not None:
+                    if self.last_sequence is not None:
+                        self.lost += (frame[0] - self.last_sequence - 1) & 0xFF
+                    self.last_sequence = frame[0]
+                    self.frames += 1
+                    yield frame
+                elif self.synchronized:
+                    # The chunk before the first delimiter may be the tail of a frame
+                    self.errors += 1
+            self.synchronized = True
+            self.buffer.clear()
+
+
+def open_input(args):
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("--port requires pyserial (pip install pyserial)")
+        port = serial.Serial(args.port, args.baud, timeout=0.1)
+        return lambda: port.read(4096) or b""
+    stream = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    return lambda: stream.read(65536) or None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", default="-", help="capture file, or - for standard input")
+    parser.add_argument("--port", help="serial port to read instead of a file (runs until Ctrl+C)")
+    parser.add_argument("--baud", type=int, default=500000, help="serial baud rate (default: 500000)")
+    args = parser.parse_args()
+
+    read = open_input(args)
+    decoder = StreamDecoder()
+    out = sys.stdout
+    out.write("sequence,timestamp_us,count,raw_rpm,rpm\n")
+    try:
+        while True:
+            data = read()
+            if data is None:
+                break
+            for sequence, timestamp, count, raw_rpm, rpm in decoder.feed(data):
+                out.write("%d,%d,%d,%.9g,%.9g\n" % (sequence, timestamp, count, raw_rpm, rpm))
+    except KeyboardInterrupt:
+        pass
+
+    sys.stderr.write("%d frames, %d rejected, %d lost\n" % (decoder.frames, decoder.errors, decoder.lost))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file adaptive_filter_table_tests.cpp
+ * @brief Test cases for AdaptiveFilterTable lookups and the adaptive filter response, built against the host Arduino shim.
+ * Built by the CMake host build (see CMakeLists.txt).
+ */
+
+#include <iostream>
+#include <cmath>
+
+#include "SpeedEstimator.h"
+#include "AdaptiveFilterTable.h"
+
+using namespace std;
+
+static const float CUTOFF_HZ = 5.0f;
+static const uint32_t NOMINAL_US = 10000;
+
+static bool check(const char* name, double value, double expected, double tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << " (± " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Whether a table entry is the first-order design for a sample time.
+ */
+static bool isDesignFor(const AdaptiveFilterTable::Coefficients& coeffs, uint32_t sampleMicros) {
+    IIRFilter design = IIRFilter::butterworth1(CUTOFF_HZ, (float)sampleMicros * 1.0e-6f);
+    return fabs(coeffs.b - design.b0()) < 1e-6f && fabs(coeffs.a1 - design.a1()) < 1e-6f;
+}
+
+// ============================================================================
+// Test 1: Lookup
+// ============================================================================
+int testLookup() {
+    cout << "\n=== Test 1: AdaptiveFilterTable::lookup ===" << endl;
+    int failures = 0;
+    AdaptiveFilterTable table(CUTOFF_HZ, NOMINAL_US);
+    const uint32_t BIN_US = 2 * NOMINAL_US / AdaptiveFilterTable::BINS;
+
+    failures += check("Case 1.1: Nominal period", isDesignFor(table.lookup(NOMINAL_US), NOMINAL_US), 1, 0) ? 0 : 1;
+    failures += check("Case 1.2: Rounded to the nearest bin",
+                      isDesignFor(table.lookup(3 * BIN_US + BIN_US / 2 - 1), 3 * BIN_US) &&
+                      isDesignFor(table.lookup(3 * BIN_US + BIN_US / 2 + 1), 4 * BIN_US), 1, 0) ? 0 : 1;
+    failures += check("Case 1.3: Longer than the table: last entry",
+                      isDesignFor(table.lookup(10 * NOMINAL_US), 2 * NOMINAL_US), 1, 0) ? 0 : 1;
+
+    // Case 1.4: Below half a bin, the first entry (not a design for dt = 0, which is b = 0, a1 = -1)
+    const AdaptiveFilterTable::Coefficients& shortest = table.lookup(1);
+    failures += check("Case 1.4a: 1 us uses the first bin", isDesignFor(shortest, BIN_US), 1, 0) ? 0 : 1;
+    failures += check("Case 1.4b: First bin passes the input (b > 0)", shortest.b > 0, 1, 0) ? 0 : 1;
+    return failures;
+}
+
+/**
+ * @brief Time for the filtered speed to reach 1 - 1/e of a speed step, in microseconds.
+ * @param periods Call intervals, used in turn.
+ */
+static double stepRiseTime(const uint32_t* periods, size_t count) {
+    AdaptiveFilterTable table(CUTOFF_HZ, NOMINAL_US);
+    SpeedEstimator speedEstimator(22.0f, 9.3f);
+    speedEstimator.setAdaptiveFilter(&table);
+    // At rest, then 1 pulse per 100 us from START
+    const uint32_t START = 1000000;
+    const float speed = 0.01f * 60.0e6f / (22.0f * 9.3f);
+    const float target = (1.0f - expf(-1.0f)) * speed;
+    uint32_t time = START;
+    float previousOutput = speedEstimator.estimateSpeed(0, time);
+    for (size_t i = 0; i < 10000; i++) {
+        uint32_t previous = time;
+        time += periods[i % count];
+        float output = speedEstimator.estimateSpeed((int)((time - START) / 100), time);
+        if (output >= target) {
+            // Linear interpolation within the last interval
+            double fraction = (target - previousOutput) / (output - previousOutput);
+            return (double)(previous - START) + (double)(time - previous) * fraction;
+        }
+        previousOutput = output;
+    }
+    return 1e9;
+}
+
+// ============================================================================
+// Test 2: Filter response with a jittering period
+// ============================================================================
+int testResponse() {
+    cout << "\n=== Test 2: Step response with a jittering period ===" << endl;
+    int failures = 0;
+    // Continuous first-order time constant 1 / (2 pi fc), plus half of the first interval:
+    // the bilinear design averages the input over each interval
+    const double tau = 1e6 / (2.0 * M_PI * CUTOFF_HZ);
+
+    const uint32_t nominal[] = {NOMINAL_US};
+    const uint32_t jitter[] = {4000, 16000, 7000, 13000};
+    const uint32_t fast[] = {200};
+    failures += check("Case 2.1: Nominal period, rise time (us)", stepRiseTime(nominal, 1), tau + nominal[0] / 2,
+                      0.1 * tau) ? 0 : 1;
+    failures += check("Case 2.2: Jittering period, same rise time (us)", stepRiseTime(jitter, 4), tau + jitter[0] / 2,
+                      0.1 * tau) ? 0 : 1;
+    // Calls far shorter than the table: all use the first bin (1.25 ms), so the filter
+    // is faster than designed, but it does not freeze
+    double fastRise = stepRiseTime(fast, 1);
+    failures += check("Case 2.3: 200 us calls still follow the step", fastRise > 0 && fastRise < tau, 1, 0) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 3: Timestamps in CPU ticks
+// ============================================================================
+int testTimestampRate() {
+    cout << "\n=== Test 3: Lookup with 16 MHz timestamps ===" << endl;
+    AdaptiveFilterTable table(CUTOFF_HZ, NOMINAL_US);
+    SpeedEstimator cpuTicks(22.0f, 9.3f);
+    SpeedEstimator reference(22.0f, 9.3f);
+    cpuTicks.setTimestampRate(16000000UL);
+    cpuTicks.setAdaptiveFilter(&table);
+    reference.setAdaptiveFilter(&table);
+
+    // The sample times are converted back to microseconds for the lookup
+    const uint32_t jitter[] = {4000, 16000, 7000, 13000};
+    uint32_t time = 1000000;
+    float worst = 0;
+    for (int i = 0; i < 200; i++) {
+        time += jitter[i % 4];
+        float a = cpuTicks.estimateSpeed(i * 7, time * 16);
+        float b = reference.estimateSpeed(i * 7, time);
+        worst = fmaxf(worst, fabsf(a - b) / fmaxf(fabsf(b), 1.0f));
+    }
+    return check("Case 3.1: Same output as with microsecond timestamps (relative error)", worst, 0.0, 1e-5) ? 0 : 1;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  AdaptiveFilterTable Test Suite                            ║" << endl;
+    cout << "║  Lookups and filter response at a jittering period         ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testLookup();
+    failures += testResponse();
+    failures += testTimestampRate();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
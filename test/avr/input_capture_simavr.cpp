@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file input_capture_simavr.cpp
+ * @brief AVR test of AvrInputCapture on the Timer1 model of simavr (ATmega328P).
+ *
+ * ICP1 (PB0) is driven as an output, so each rising edge written to the pin is
+ * captured by Timer1. Edges are generated one tick later than one timer period
+ * apart, starting 100 ticks before a wrap, so they sweep across the overflow. Half
+ * of them are issued with interrupts disabled until after the wrap, so the capture
+ * ISR runs with the overflow still pending. Every capture must be later than the
+ * previous one by the programmed spacing (within the loop jitter).
+ *
+ * The result is printed on USART0 and the CPU is put to sleep with interrupts
+ * disabled, which ends the simavr run. See the Makefile in this directory.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "InputCapture.h"
+
+static const uint16_t EDGES = 200;
+static const uint32_t SPACING = 65536UL + 1; // Ticks between edges
+static const uint32_t TOLERANCE = 64; // Busy-wait loop jitter, in ticks
+
+AvrInputCapture capture;
+
+ISR(TIMER1_CAPT_vect) { capture.onCapture(); }
+ISR(TIMER1_OVF_vect) { capture.onOverflow(); }
+
+static void uartPrint(const char* text) {
+    while (*text) {
+        while (!(UCSR0A & _BV(UDRE0))) {
+        }
+        UDR0 = *text++;
+    }
+}
+
+static void uartPrintNumber(uint32_t value) {
+    char buffer[11];
+    uint8_t i = sizeof(buffer) - 1;
+    buffer[i] = '\0';
+    do {
+        buffer[--i] = '0' + (value % 10);
+        value /= 10;
+    } while (value != 0);
+    uartPrint(&buffer[i]);
+}
+
+int main() {
+    UBRR0 = 8; // 115200 baud at 16 MHz
+    UCSR0B = _BV(TXEN0);
+
+    DDRB |= _BV(PB0); // Drive ICP1 from the firmware
+    PORTB &= ~_BV(PB0);
+
+    capture.begin();
+    sei();
+
+    uint16_t failures = 0;
+    uint32_t previousEdge = 0;
+    int32_t previousCount = 0;
+    // First edge 100 ticks before the second wrap from now
+    uint32_t next = (capture.now() & 0xFFFF0000UL) + 0x20000UL - 100;
+
+    for (uint16_t i = 0; i < EDGES; i++) {
+        while ((int32_t)(capture.now() - next) < 0) {
+        }
+
+        if (i & 1) {
+            // Rising edge with interrupts disabled across the timer wrap
+            cli();
+            PORTB |= _BV(PB0);
+            uint16_t start = TCNT1;
+            while ((uint16_t)(TCNT1 - start) < 200) {
+            }
+            sei();
+        } else {
+            PORTB |= _BV(PB0);
+        }
+        PORTB &= ~_BV(PB0);
+        next += SPACING;
+
+        // Let the ISRs run, then read the snapshot
+        uint16_t start = TCNT1;
+        while ((uint16_t)(TCNT1 - start) < 400) {
+        }
+        int32_t count;
+        uint32_t edge;
+        capture.snapshot().read(count, edge);
+
+        if (count != previousCount + 1) {
+            failures++;
+        } else if (i > 0) {
+            uint32_t delta = edge - previousEdge;
+            if (delta + TOLERANCE < SPACING || delta > SPACING + TOLERANCE) {
+                failures++;
+                uartPrint("edge ");
+                uartPrintNumber(i);
+                uartPrint(" delta ");
+                uartPrintNumber(delta);
+                uartPrint("\n");
+            }
+        }
+        previousEdge = edge;
+        previousCount = count;
+    }
+
+    uartPrint(failures == 0 ? "input_capture_simavr: PASS\n" : "input_capture_simavr: FAIL\n");
+
+    // Sleeping with interrupts disabled stops simavr
+    cli();
+    sleep_enable();
+    sleep_cpu();
+    return 0;
+}
@@ -12,6 +12,7 @@
 #include <iomanip>
 #include <cstdint>
 #include <limits>
+#include <climits>
 #include <bitset>
 
 using namespace std;
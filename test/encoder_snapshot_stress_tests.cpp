@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file encoder_snapshot_stress_tests.cpp
+ * @brief Stress test for the EncoderSnapshot seqlock with a writer and a reader on separate threads.
+ * C++11 standard is used. Compile this file with a C++11 compatible compiler like g++ or clang++:
+ * g++ -std=c++11 -O2 -pthread -I.. encoder_snapshot_stress_tests.cpp
+ */
+
+#include <iostream>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+
+#include "EncoderSnapshot.h"
+
+using namespace std;
+
+// The writer always publishes timestamp = f(count), so a torn read breaks the relation
+static uint32_t timestampFor(int32_t count) {
+    return (uint32_t)count * 2654435761UL + 12345UL;
+}
+
+// ============================================================================
+// Test 1: Single-threaded round trip
+// ============================================================================
+bool testRoundTrip() {
+    cout << "\n=== Test 1: Single-threaded round trip ===" << endl;
+
+    EncoderSnapshot snapshot;
+    snapshot.write(-42, 1000UL);
+    snapshot.increment(3, 2000UL);
+
+    int32_t count;
+    uint32_t timestamp;
+    uint8_t retries = snapshot.read(count, timestamp);
+
+    bool pass = (count == -39 && timestamp == 2000UL && retries == 0);
+    cout << "  count = " << count << ", timestamp = " << timestamp << ", retries = " << (int)retries << endl;
+    cout << "  Expected: count = -39, timestamp = 2000, retries = 0" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+// ============================================================================
+// Test 2: Concurrent writer and reader
+// ============================================================================
+bool testConcurrentWriterReader() {
+    cout << "\n=== Test 2: Concurrent writer and reader ===" << endl;
+
+    const int32_t WRITES = 20000000;
+    EncoderSnapshot snapshot;
+    snapshot.write(0, timestampFor(0));
+
+    atomic<bool> done(false);
+    uint64_t reads = 0;
+    uint64_t retriedReads = 0;
+    uint64_t tornReads = 0;
+    uint64_t backwardReads = 0;
+
+    thread reader([&]() {
+        int32_t previous = 0;
+        while (!done.load(memory_order_relaxed)) {
+            int32_t count;
+            uint32_t timestamp;
+            if (snapshot.read(count, timestamp) != 0) {
+                retriedReads++;
+            }
+            if (timestamp != timestampFor(count)) {
+                tornReads++;
+            }
+            if (count < previous) {
+                backwardReads++;
+            }
+            previous = count;
+            reads++;
+        }
+    });
+
+    thread writer([&]() {
+        for (int32_t i = 1; i <= WRITES; i++) {
+            snapshot.increment(1, timestampFor(i));
+        }
+        done.store(true, memory_order_relaxed);
+    });
+
+    writer.join();
+    reader.join();
+
+    int32_t count;
+    uint32_t timestamp;
+    snapshot.read(count, timestamp);
+
+    bool pass = (tornReads == 0 && backwardReads == 0 && count == WRITES);
+    cout << "  writes = " << WRITES << ", reads = " << reads << ", retried reads = " << retriedReads << endl;
+    cout << "  torn reads = " << tornReads << ", backward reads = " << backwardReads << endl;
+    cout << "  final count = " << count << endl;
+    cout << "  Expected: no torn or backward reads, final count = " << WRITES << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  EncoderSnapshot Seqlock Stress Test Suite                 ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    cout << "\nSystem information:" << endl;
+    cout << "  hardware threads = " << thread::hardware_concurrency() << endl;
+
+    int failures = 0;
+    failures += testRoundTrip() ? 0 : 1;
+    failures += testConcurrentWriterReader() ? 0 : 1;
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file iir_filter_tests.cpp
+ * @brief Test cases for the IIRFilter Butterworth designs, built against the host Arduino shim.
+ * Built by the CMake host build (see CMakeLists.txt).
+ */
+
+#include <iostream>
+#include <cmath>
+#include <complex>
+
+#include "IIRFilter.h"
+
+using namespace std;
+
+static bool check(const char* name, double value, double expected, double tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << " (± " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Magnitude of the filter frequency response at frequencyHz.
+ */
+static double gain(const IIRFilter& filter, double frequencyHz, double sampleTime) {
+    complex<double> z1 = polar(1.0, -2.0 * M_PI * frequencyHz * sampleTime); // z^-1
+    complex<double> z2 = z1 * z1;
+    complex<double> numerator = (double)filter.b0() + (double)filter.b1() * z1 + (double)filter.b2() * z2;
+    complex<double> denominator = 1.0 + (double)filter.a1() * z1 + (double)filter.a2() * z2;
+    return abs(numerator / denominator);
+}
+
+/**
+ * @brief Amplitude of the filtered output of a sine, measured once settled.
+ */
+static double measuredGain(IIRFilter filter, double frequencyHz, double sampleTime) {
+    const int SAMPLES = 20000;
+    double peak = 0;
+    for (int i = 0; i < SAMPLES; i++) {
+        float y = filter.update((float)sin(2.0 * M_PI * frequencyHz * sampleTime * i));
+        if (i >= SAMPLES / 2) {
+            peak = fmax(peak, fabs((double)y));
+        }
+    }
+    return peak;
+}
+
+/**
+ * @brief Largest pole magnitude (the filter is stable below 1).
+ */
+static double poleRadius(const IIRFilter& filter) {
+    // Roots of z^2 + a1 z + a2
+    complex<double> root = sqrt(complex<double>((double)filter.a1() * filter.a1() - 4.0 * filter.a2()));
+    return fmax(abs((-(double)filter.a1() + root) / 2.0), abs((-(double)filter.a1() - root) / 2.0));
+}
+
+// ============================================================================
+// Test 1: Default coefficients
+// ============================================================================
+int testDefault() {
+    cout << "\n=== Test 1: Default filter ===" << endl;
+    int failures = 0;
+    IIRFilter defaults;
+    IIRFilter design = IIRFilter::butterworth1(5.0f, 0.01f);
+
+    failures += check("Case 1.1a: b0 = 0.1367", defaults.b0(), 0.1367, 1e-6) ? 0 : 1;
+    failures += check("Case 1.1b: b1 = 0.1367", defaults.b1(), 0.1367, 1e-6) ? 0 : 1;
+    failures += check("Case 1.1c: a1 = -0.7265", defaults.a1(), -0.7265, 1e-6) ? 0 : 1;
+    failures += check("Case 1.1d: No second-order terms", fabs(defaults.b2()) + fabs(defaults.a2()), 0.0, 0.0) ? 0 : 1;
+    // The historical values are the 5 Hz / 10 ms design rounded to 4 decimals
+    failures += check("Case 1.2a: butterworth1(5 Hz, 10 ms) b0", design.b0(), defaults.b0(), 5e-5) ? 0 : 1;
+    failures += check("Case 1.2b: butterworth1(5 Hz, 10 ms) a1", design.a1(), defaults.a1(), 5e-5) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Frequency response of the designs
+// ============================================================================
+int testResponse() {
+    cout << "\n=== Test 2: Unity DC gain and -3 dB at the cutoff ===" << endl;
+    int failures = 0;
+    const double halfPower = 1.0 / sqrt(2.0);
+
+    struct Design {
+        float cutoffHz;
+        float sampleTime;
+    };
+    const Design designs[] = {{5.0f, 0.01f}, {20.0f, 0.001f}, {1.0f, 0.001f}, {150.0f, 0.001f}};
+    bool dc = true;
+    double worst1 = 0, worst2 = 0;
+    for (const Design& d : designs) {
+        IIRFilter first = IIRFilter::butterworth1(d.cutoffHz, d.sampleTime);
+        IIRFilter second = IIRFilter::butterworth2(d.cutoffHz, d.sampleTime);
+        dc = dc && fabs(gain(first, 0, d.sampleTime) - 1.0) < 1e-5 && fabs(gain(second, 0, d.sampleTime) - 1.0) < 1e-5;
+        double error1 = fabs(gain(first, d.cutoffHz, d.sampleTime) - halfPower);
+        double error2 = fabs(gain(second, d.cutoffHz, d.sampleTime) - halfPower);
+        worst1 = fmax(worst1, error1);
+        worst2 = fmax(worst2, error2);
+    }
+    failures += check("Case 2.1: Unity DC gain (both orders)", dc ? 1 : 0, 1, 0) ? 0 : 1;
+    failures += check("Case 2.2: butterworth1 gain at the cutoff - 1/sqrt(2)", worst1, 0.0, 1e-4) ? 0 : 1;
+    // Float coefficients move the second-order poles slightly at low cutoffs (1 Hz at 1 kHz)
+    failures += check("Case 2.3: butterworth2 gain at the cutoff - 1/sqrt(2)", worst2, 0.0, 1e-3) ? 0 : 1;
+
+    // Case 2.4: The same, measured by filtering a sine at the cutoff
+    failures += check("Case 2.4a: Filtered 20 Hz sine at 1 kHz, butterworth1",
+                      measuredGain(IIRFilter::butterworth1(20.0f, 0.001f), 20.0, 0.001), halfPower, 1e-3) ? 0 : 1;
+    failures += check("Case 2.4b: Filtered 20 Hz sine at 1 kHz, butterworth2",
+                      measuredGain(IIRFilter::butterworth2(20.0f, 0.001f), 20.0, 0.001), halfPower, 1e-3) ? 0 : 1;
+
+    // Case 2.5: The second order rolls off at 40 dB/decade: -40 dB a decade above the cutoff
+    failures += check("Case 2.5: butterworth2 gain at 10x the cutoff (dB)",
+                      20.0 * log10(gain(IIRFilter::butterworth2(5.0f, 0.001f), 50.0, 0.001)), -40.0, 0.5) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 3: Cutoff limit
+// ============================================================================
+int testClamp() {
+    cout << "\n=== Test 3: Cutoff limited to 0.45 fs ===" << endl;
+    int failures = 0;
+    const float sampleTime = 0.001f;
+
+    // Above 0.45 fs (450 Hz at 1 kHz), and at or beyond Nyquist where tan() diverges,
+    // the design is the one for 0.45 fs
+    const float requested[] = {600.0f, 500.0f, 1000.0f, 1e6f};
+    for (int order = 1; order <= 2; order++) {
+        IIRFilter limit = (order == 1) ? IIRFilter::butterworth1(450.0f, sampleTime)
+                                       : IIRFilter::butterworth2(450.0f, sampleTime);
+        bool same = true, stable = true;
+        for (float hz : requested) {
+            IIRFilter f = (order == 1) ? IIRFilter::butterworth1(hz, sampleTime) : IIRFilter::butterworth2(hz, sampleTime);
+            same = same && f.b0() == limit.b0() && f.b1() == limit.b1() && f.b2() == limit.b2() &&
+                   f.a1() == limit.a1() && f.a2() == limit.a2();
+            stable = stable && poleRadius(f) < 1.0;
+        }
+        cout << "  butterworth" << order << ": pole radius " << poleRadius(limit) << endl;
+        failures += check(order == 1 ? "Case 3.1a: butterworth1 above 0.45 fs uses the 0.45 fs design"
+                                     : "Case 3.2a: butterworth2 above 0.45 fs uses the 0.45 fs design",
+                          same ? 1 : 0, 1, 0) ? 0 : 1;
+        failures += check(order == 1 ? "Case 3.1b: butterworth1 stays stable" : "Case 3.2b: butterworth2 stays stable",
+                          stable ? 1 : 0, 1, 0) ? 0 : 1;
+        failures += check(order == 1 ? "Case 3.1c: butterworth1 -3 dB at 0.45 fs" : "Case 3.2c: butterworth2 -3 dB at 0.45 fs",
+                          gain(limit, 450.0, sampleTime), 1.0 / sqrt(2.0), 1e-4) ? 0 : 1;
+    }
+
+    // Case 3.3: Just below the limit the design is not clamped
+    IIRFilter below = IIRFilter::butterworth1(400.0f, sampleTime);
+    failures += check("Case 3.3: 0.4 fs is designed for 0.4 fs (gain at 400 Hz)", gain(below, 400.0, sampleTime),
+                      1.0 / sqrt(2.0), 1e-4) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  IIRFilter Test Suite                                      ║" << endl;
+    cout << "║  Butterworth designs: defaults, response and limits        ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testDefault();
+    failures += testResponse();
+    failures += testClamp();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file parallel_scan_filter_tests.cpp
+ * @brief Test cases comparing the chunked parallel filter with sequential filtering.
+ * C++11 standard is used. Compile this file with a C++11 compatible compiler like g++ or clang++:
+ * g++ -std=c++11 -pthread -I.. parallel_scan_filter_tests.cpp ../extras/scan/ParallelScanFilter.cpp
+ */
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "extras/scan/ParallelScanFilter.h"
+
+using namespace std;
+
+/**
+ * @brief Reference: the IIRFilter::update() difference equation, one sample at a time.
+ */
+struct SequentialFilter {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+
+    SequentialFilter(float b0_, float b1_, float b2_, float a1_, float a2_)
+        : b0(b0_), b1(b1_), b2(b2_), a1(a1_), a2(a2_), x1(0), x2(0), y1(0), y2(0) {}
+
+    float update(float x) {
+        float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        return y;
+    }
+};
+
+/**
+ * @brief Velocity-like trace: slow ramps and steps with quantization noise.
+ */
+static vector<float> makeTrace(size_t n) {
+    vector<float> trace(n);
+    srand(7);
+    float level = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (i % 50000 == 0) {
+            level = (float)(rand() % 4000) - 2000.0f;
+        }
+        trace[i] = level + 29.3f * (float)(rand() % 5 - 2);
+    }
+    return trace;
+}
+
+/**
+ * @brief Filter the trace in blocks with both implementations and compare.
+ * @return Maximum error relative to the largest output.
+ */
+static float maxRelativeError(const float* coeffs, unsigned threads, size_t n, size_t block) {
+    vector<float> trace = makeTrace(n);
+    vector<float> parallel = trace;
+
+    SequentialFilter reference(coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4]);
+    ParallelScanFilter filter(coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4], threads);
+
+    for (size_t start = 0; start < n; start += block) {
+        size_t length = (n - start < block) ? n - start : block;
+        filter.process(&parallel[start], length);
+    }
+
+    float maxError = 0, maxOutput = 0;
+    for (size_t i = 0; i < n; i++) {
+        float expected = reference.update(trace[i]);
+        maxError = fmax(maxError, fabs(parallel[i] - expected));
+        maxOutput = fmax(maxOutput, fabs(expected));
+    }
+    return maxError / maxOutput;
+}
+
+// ============================================================================
+// Test 1: First- and second-order filters, several thread counts and block sizes
+// ============================================================================
+int testMatchesSequential() {
+    cout << "\n=== Test 1: Parallel vs sequential filtering ===" << endl;
+    int failures = 0;
+
+    // Default SpeedEstimator filter, and a 20 Hz second-order Butterworth at 1 kHz
+    const float FIRST_ORDER[5] = {0.1367f, 0.1367f, 0.0f, -0.7265f, 0.0f};
+    const float SECOND_ORDER[5] = {0.003621f, 0.007243f, 0.003621f, -1.822695f, 0.837182f};
+    const float TOLERANCE = 1e-5f;
+
+    struct Case {
+        const char* name;
+        const float* coeffs;
+        unsigned threads;
+        size_t block;
+    };
+    const Case CASES[] = {
+        {"Case 1.1: First order, 2 threads, one block", FIRST_ORDER, 2, 1000000},
+        {"Case 1.2: First order, 3 threads, uneven blocks", FIRST_ORDER, 3, 123457},
+        {"Case 1.3: First order, 8 threads, small blocks (sequential path)", FIRST_ORDER, 8, 5000},
+        {"Case 1.4: Second order, 4 threads, one block", SECOND_ORDER, 4, 1000000},
+        {"Case 1.5: Second order, 7 threads, uneven blocks", SECOND_ORDER, 7, 300001},
+    };
+
+    for (const Case& c : CASES) {
+        float error = maxRelativeError(c.coeffs, c.threads, 1000000, c.block);
+        bool pass = (error < TOLERANCE);
+        cout << c.name << endl;
+        cout << "  Max error / max output: " << error << endl;
+        cout << "  Tolerance: " << TOLERANCE << endl;
+        cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+        failures += pass ? 0 : 1;
+    }
+
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  Parallel Scan Filter Test Suite                           ║" << endl;
+    cout << "║  Chunked multithreaded IIR vs sequential processing        ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = testMatchesSequential();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file pulse_counter_tests.cpp
+ * @brief Test cases for the 16-bit hardware counter extension logic, using a mock HAL.
+ * C++11 standard is used. Compile this file with a C++11 compatible compiler like g++ or clang++:
+ * g++ -std=c++11 -I.. pulse_counter_tests.cpp
+ */
+
+#include <iostream>
+#include <cstdint>
+
+#include "PulseCounter.h"
+
+using namespace std;
+
+/**
+ * @brief Register model of a 16-bit counter peripheral.
+ *
+ * Up-counter mode models AVR Timer1 (0..65535, TOV flag on overflow). Limit mode
+ * models the ESP32 PCNT (counter restarts from 0 at +/-limit, event flag set).
+ * pulsesAfterRawRead lets a test inject pulses between the register reads done by read().
+ */
+class MockCounterHal : public Counter16Hal {
+    public:
+        int32_t raw;
+        int8_t pending;
+        int32_t limit; ///< 0: free-running 16-bit up-counter, otherwise symmetric limit.
+        int32_t pulsesAfterRawRead; ///< Pulses counted right after the next readRaw().
+
+        explicit MockCounterHal(int32_t limitValue = 0) : raw(0), pending(0), limit(limitValue), pulsesAfterRawRead(0) {}
+
+        void configure() {
+            raw = 0;
+            pending = 0;
+        }
+
+        int32_t readRaw() {
+            int32_t value = raw;
+            if (pulsesAfterRawRead != 0) {
+                pulse(pulsesAfterRawRead);
+                pulsesAfterRawRead = 0;
+            }
+            return value;
+        }
+
+        int8_t pendingWrap() { return pending; }
+
+        /**
+         * @brief Count pulses in hardware (positive or negative), flagging wraps.
+         */
+        void pulse(int32_t pulses) {
+            int8_t step = (pulses > 0) ? 1 : -1;
+            for (int32_t i = 0; i != pulses; i += step) {
+                raw += step;
+                if (limit == 0 && raw > 0xFFFF) {
+                    raw = 0;
+                    pending = 1;
+                } else if (limit != 0 && (raw >= limit || raw <= -limit)) {
+                    pending = (raw > 0) ? 1 : -1;
+                    raw = 0;
+                }
+            }
+        }
+
+        /**
+         * @brief Run the wrap ISR if a wrap is pending.
+         */
+        void service(ExtendedPulseCounter& counter) {
+            if (pending != 0) {
+                counter.onWrap(pending);
+                pending = 0;
+            }
+        }
+};
+
+static bool check(const char* name, int32_t value, int32_t expected) {
+    bool pass = (value == expected);
+    cout << name << endl;
+    cout << "  Read: " << value << endl;
+    cout << "  Expected: " << expected << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+// ============================================================================
+// Test 1: AVR Timer1 style free-running up-counter
+// ============================================================================
+int testUpCounter() {
+    cout << "\n=== Test 1: 16-bit up-counter (AVR Timer1) ===" << endl;
+    int failures = 0;
+
+    MockCounterHal hal;
+    ExtendedPulseCounter counter(hal, 65536L);
+    counter.begin();
+
+    hal.pulse(1000);
+    failures += check("Case 1.1: No wrap", counter.read(), 1000) ? 0 : 1;
+
+    hal.pulse(65536L);
+    failures += check("Case 1.2: Wrapped, ISR not serviced yet", counter.read(), 66536L) ? 0 : 1;
+
+    hal.service(counter);
+    failures += check("Case 1.3: Wrapped, ISR serviced", counter.read(), 66536L) ? 0 : 1;
+
+    // Each wrap must be serviced before the next one
+    MockCounterHal hal2;
+    ExtendedPulseCounter counter2(hal2, 65536L);
+    counter2.begin();
+    for (int i = 0; i < 5; i++) {
+        hal2.pulse(40000L);
+        hal2.service(counter2);
+    }
+    failures += check("Case 1.4: 200000 pulses with timely ISRs", counter2.read(), 200000L) ? 0 : 1;
+
+    // Raw value read just before the wrap, flag seen set afterwards: must not be double counted
+    MockCounterHal hal3;
+    ExtendedPulseCounter counter3(hal3, 65536L);
+    counter3.begin();
+    hal3.pulse(65535L);
+    hal3.pulsesAfterRawRead = 1;
+    failures += check("Case 1.5: Wrap between raw read and flag read", counter3.read(), 65535L) ? 0 : 1;
+    hal3.service(counter3);
+    failures += check("Case 1.6: Same counter after the ISR", counter3.read(), 65536L) ? 0 : 1;
+
+    return failures;
+}
+
+// ============================================================================
+// Test 2: ESP32 PCNT style up/down counter with symmetric limits
+// ============================================================================
+int testLimitCounter() {
+    cout << "\n=== Test 2: Up/down counter with limits (ESP32 PCNT) ===" << endl;
+    int failures = 0;
+
+    const int32_t LIMIT = 32000;
+    MockCounterHal hal(LIMIT);
+    ExtendedPulseCounter counter(hal, LIMIT);
+    counter.begin();
+
+    hal.pulse(31999);
+    failures += check("Case 2.1: Below the high limit", counter.read(), 31999) ? 0 : 1;
+
+    hal.pulse(5);
+    failures += check("Case 2.2: High limit reached, ISR not serviced yet", counter.read(), 32004) ? 0 : 1;
+    hal.service(counter);
+    failures += check("Case 2.3: High limit reached, ISR serviced", counter.read(), 32004) ? 0 : 1;
+
+    hal.pulse(-32004);
+    hal.service(counter);
+    failures += check("Case 2.4: Back to zero (down through the reset point)", counter.read(), 0) ? 0 : 1;
+
+    hal.pulse(-32000);
+    failures += check("Case 2.5: Low limit reached, ISR not serviced yet", counter.read(), -32000) ? 0 : 1;
+    hal.service(counter);
+    hal.pulse(-100);
+    failures += check("Case 2.6: Below the low limit", counter.read(), -32100) ? 0 : 1;
+
+    return failures;
+}
+
+// ============================================================================
+// Test 3: Software fallback
+// ============================================================================
+int testSoftwareCounter() {
+    cout << "\n=== Test 3: Software pulse counter ===" << endl;
+
+    SoftwarePulseCounter counter;
+    counter.begin();
+    for (int i = 0; i < 10; i++) {
+        counter.add(1, 100UL * i);
+    }
+    counter.add(-3, 1000UL);
+
+    return check("Case 3.1: Signed steps", counter.read(), 7) ? 0 : 1;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  Pulse Counter Backend Test Suite                          ║" << endl;
+    cout << "║  16-bit hardware counter extension with a mock HAL         ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testUpCounter();
+    failures += testLimitCounter();
+    failures += testSoftwareCounter();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file sampling_scheduler_tests.cpp
+ * @brief Test cases for the deadline-based and timer-tick sampling schedulers.
+ * Built by the CMake host build (see CMakeLists.txt), or by hand:
+ * g++ -std=c++11 -I.. -I../extras/host sampling_scheduler_tests.cpp ../[A-Z]*.cpp ../extras/host/Arduino.cpp
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "SamplingScheduler.h"
+
+using namespace std;
+
+static bool check(const char* name, bool pass) {
+    cout << name << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Run a loop polling every stepMicros, plus extra busy time after some iterations.
+ * @return Times at which samples were triggered.
+ */
+static vector<uint32_t> runLoop(SamplingScheduler& scheduler, uint32_t start, uint32_t duration, uint32_t stepMicros,
+                                uint32_t (*busy)(uint32_t iteration)) {
+    vector<uint32_t> sampleTimes;
+    uint32_t now = start;
+    scheduler.begin(now);
+    for (uint32_t i = 0; (uint32_t)(now - start) < duration; i++) {
+        if (scheduler.poll(now)) {
+            sampleTimes.push_back(now);
+        }
+        now += stepMicros + (busy != nullptr ? busy(i) : 0);
+    }
+    return sampleTimes;
+}
+
+static uint32_t noBusy(uint32_t) { return 0; }
+
+// Up to 3 ms of extra work, irregularly
+static uint32_t jitterBusy(uint32_t i) { return ((i * 7919U) % 13U == 0) ? 3000 : ((i * 31U) % 5U) * 100U; }
+
+// A 45 ms stall once, right after a sample
+static uint32_t stallBusy(uint32_t i) { return (i == 5000) ? 45000 : 0; }
+
+// ============================================================================
+// Test 1: Deadline scheduler
+// ============================================================================
+int testDeadline() {
+    cout << "\n=== Test 1: Deadline scheduler (micros()) ===" << endl;
+    int failures = 0;
+
+    // Case 1.1: One sample per period, at the deadlines
+    {
+        SamplingScheduler scheduler(10000);
+        vector<uint32_t> times = runLoop(scheduler, 1000, 1000000, 10, noBusy);
+        bool exact = times.size() == 100;
+        for (size_t k = 0; k < times.size(); k++) {
+            exact = exact && times[k] == 1000 + k * 10000;
+        }
+        cout << "  Samples in 1 s: " << times.size() << endl;
+        failures += check("Case 1.1: 100 samples in 1 s, exactly 10 ms apart", exact && scheduler.overruns() == 0) ? 0 : 1;
+    }
+
+    // Case 1.2: Irregular loop time does not accumulate drift
+    {
+        SamplingScheduler scheduler(10000);
+        vector<uint32_t> times = runLoop(scheduler, 0, 10000000, 50, jitterBusy);
+        bool onSchedule = true;
+        for (size_t k = 0; k < times.size(); k++) {
+            uint32_t late = times[k] - (uint32_t)k * 10000U;
+            onSchedule = onSchedule && late < 3500;
+        }
+        cout << "  Samples in 10 s: " << times.size() << ", max lateness: " << scheduler.maxLateness() << " us" << endl;
+        failures += check("Case 1.2: Each sample within one loop iteration of its deadline, no drift",
+                          times.size() == 1000 && onSchedule && scheduler.overruns() == 0 &&
+                          scheduler.maxLateness() < 3500) ? 0 : 1;
+    }
+
+    // Case 1.3: A stall of 4.5 periods: one sample late, 3 skipped, phase kept
+    {
+        SamplingScheduler scheduler(10000);
+        vector<uint32_t> times = runLoop(scheduler, 0, 1000000, 10, stallBusy);
+        bool phase = true;
+        for (size_t k = 1; k < times.size(); k++) {
+            phase = phase && (times[k] - times[k - 1] >= 10000 || times[k] % 10000 == 0);
+        }
+        cout << "  Samples: " << times.size() << ", overruns: " << scheduler.overruns() << endl;
+        failures += check("Case 1.3: Overruns counted, no burst of back-to-back samples",
+                          scheduler.overruns() == 3 && times.size() == 97 && phase) ? 0 : 1;
+    }
+
+    // Case 1.4: micros() wraps around during the run
+    {
+        SamplingScheduler scheduler(10000);
+        vector<uint32_t> times = runLoop(scheduler, 0xFFFFFFFFUL - 55000UL, 1000000, 10, noBusy);
+        bool regular = times.size() == 100;
+        for (size_t k = 1; k < times.size(); k++) {
+            regular = regular && (uint32_t)(times[k] - times[k - 1]) == 10000;
+        }
+        failures += check("Case 1.4: Regular across the micros() wrap", regular && scheduler.overruns() == 0) ? 0 : 1;
+    }
+
+    // Case 1.5: Period change takes effect from the last sample
+    {
+        SamplingScheduler scheduler(10000);
+        scheduler.begin(0);
+        scheduler.poll(0);
+        scheduler.setPeriod(5000);
+        bool pass = !scheduler.poll(4999) && scheduler.poll(5000) && scheduler.deadline() == 10000;
+        failures += check("Case 1.5: setPeriod() reschedules the next deadline", pass) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Timer tick scheduler
+// ============================================================================
+int testTick() {
+    cout << "\n=== Test 2: Timer tick scheduler ===" << endl;
+    int failures = 0;
+
+    // Case 2.1: 1 kHz tick, 10 ms period
+    {
+        TickScheduler scheduler(10);
+        int triggered = 0;
+        for (int tick = 0; tick < 1000; tick++) {
+            scheduler.onTick();
+            triggered += scheduler.poll() ? 1 : 0;
+            triggered += scheduler.poll() ? 1 : 0; // Polled twice per tick: still one sample
+        }
+        failures += check("Case 2.1: One sample every 10 ticks", triggered == 100 && scheduler.overruns() == 0) ? 0 : 1;
+    }
+
+    // Case 2.2: The loop misses 3 periods
+    {
+        TickScheduler scheduler(10);
+        for (int tick = 0; tick < 40; tick++) {
+            scheduler.onTick();
+        }
+        bool first = scheduler.poll();
+        bool second = scheduler.poll();
+        cout << "  Overruns: " << scheduler.overruns() << endl;
+        failures += check("Case 2.2: Late poll triggers once and counts 3 overruns",
+                          first && !second && scheduler.overruns() == 3 && scheduler.samples() == 1) ? 0 : 1;
+    }
+
+    // Case 2.3: The due counter wraps (256 samples)
+    {
+        TickScheduler scheduler;
+        int triggered = 0;
+        for (int tick = 0; tick < 1000; tick++) {
+            scheduler.onTick();
+            triggered += scheduler.poll() ? 1 : 0;
+        }
+        failures += check("Case 2.3: Every tick triggers with ticksPerSample 1", triggered == 1000) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  Sampling Scheduler Test Suite                             ║" << endl;
+    cout << "║  Fixed-rate triggering without delay()                     ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testDeadline();
+    failures += testTick();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file simd_bank_tests.cpp
+ * @brief Test cases checking that the SimdSpeedBank vector kernels match the scalar kernel exactly.
+ * C++11 standard is used. Compile this file with a C++11 compatible compiler like g++ or clang++:
+ * g++ -std=c++11 -I.. simd_bank_tests.cpp ../extras/simd/SimdSpeedBank.cpp
+ */
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "SpeedEstimator.h"
+#include "extras/simd/SimdSpeedBank.h"
+
+using namespace std;
+
+// The reference formula below must not be fused into FMAs either (e.g. with -march=native)
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+// ============================================================================
+// Test 1: Every kernel against the scalar kernel, bit for bit
+// ============================================================================
+int testKernelsMatchScalar() {
+    cout << "\n=== Test 1: Vector kernels vs scalar kernel ===" << endl;
+    int failures = 0;
+
+    // Odd channel count: exercises the scalar tail of the vector kernels
+    const size_t CHANNELS = 1003;
+    const int UPDATES = 2000;
+    SimdSpeedBank::Isa best = SimdSpeedBank::detectIsa();
+
+    for (int isa = SimdSpeedBank::ISA_SSE2; isa <= best; isa++) {
+        SimdSpeedBank reference(CHANNELS);
+        SimdSpeedBank bank(CHANNELS);
+        for (size_t c = 0; c < CHANNELS; c++) {
+            reference.configure(c, 11.0f + c % 7, 1.0f + 0.1f * (c % 13));
+            bank.configure(c, 11.0f + c % 7, 1.0f + 0.1f * (c % 13));
+        }
+        reference.setIsa(SimdSpeedBank::ISA_SCALAR);
+        bank.setIsa((SimdSpeedBank::Isa)isa);
+
+        srand(42);
+        vector<int32_t> counts(CHANNELS, 0);
+        // Start close to the timestamp wrap
+        uint32_t timestamp = 0xFFFFFFFFUL - 50000UL;
+        size_t mismatches = 0;
+
+        for (int u = 0; u < UPDATES; u++) {
+            for (size_t c = 0; c < CHANNELS; c++) {
+                // Mixed directions, and counters wrapping around INT32 limits
+                uint32_t step = (uint32_t)((rand() % 201) - 100) + ((c % 5 == 0) ? 0x7FFFFFFUL : 0);
+                counts[c] = (int32_t)((uint32_t)counts[c] + step);
+            }
+            timestamp += 9000 + rand() % 2000;
+            reference.update(counts.data(), timestamp);
+            bank.update(counts.data(), timestamp);
+            if (memcmp(reference.speeds(), bank.speeds(), CHANNELS * sizeof(float)) != 0) {
+                mismatches++;
+            }
+        }
+
+        bool pass = (mismatches == 0);
+        cout << "Kernel " << SimdSpeedBank::isaName((SimdSpeedBank::Isa)isa) << endl;
+        cout << "  updates = " << UPDATES << ", channels = " << CHANNELS << endl;
+        cout << "  updates with a different result = " << mismatches << endl;
+        cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+        failures += pass ? 0 : 1;
+    }
+
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Scalar kernel against the SpeedEstimator formula
+// ============================================================================
+int testScalarFormula() {
+    cout << "\n=== Test 2: Scalar kernel vs SpeedEstimator formula ===" << endl;
+
+    SimdSpeedBank bank(1);
+    bank.configure(0, 22.0f, 9.3f);
+    bank.setIsa(SimdSpeedBank::ISA_SCALAR);
+
+    // SpeedEstimator::estimateSpeed() with its default first-order filter
+    const float rpmScale = 60.0e6f / (22.0f * 9.3f);
+    float speedFilt = 0, speedPrev = 0;
+    int32_t prevCount = 0, count = 0;
+    uint32_t prevTime = 0, timestamp = 0;
+    bool pass = true;
+
+    for (int u = 0; u < 500; u++) {
+        count += u % 17;
+        timestamp += 10000 + u % 3;
+        float velocity = ((float)(count - prevCount)) * rpmScale / ((float)(timestamp - prevTime));
+        speedFilt = 0.1367f * velocity + 0.1367f * speedPrev - (-0.7265f) * speedFilt;
+        speedPrev = velocity;
+        prevCount = count;
+        prevTime = timestamp;
+
+        bank.update(&count, timestamp);
+        pass = pass && (bank.speed(0) == speedFilt);
+    }
+
+    cout << "  Final speed: " << bank.speed(0) << " RPM" << endl;
+    cout << "  Expected: " << speedFilt << " RPM" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass ? 0 : 1;
+}
+
+// ============================================================================
+// Test 3: Every kernel against SpeedEstimator itself
+// ============================================================================
+int testMatchesSpeedEstimator() {
+    cout << "\n=== Test 3: Kernels vs SpeedEstimator ===" << endl;
+    int failures = 0;
+    const size_t CHANNELS = 9;
+    SimdSpeedBank::Isa best = SimdSpeedBank::detectIsa();
+
+    for (int isa = SimdSpeedBank::ISA_SCALAR; isa <= best; isa++) {
+        SimdSpeedBank bank(CHANNELS);
+        vector<SpeedEstimator> estimators;
+        for (size_t c = 0; c < CHANNELS; c++) {
+            bank.configure(c, 11.0f + c, 1.0f + 0.7f * c);
+            estimators.push_back(SpeedEstimator(11.0f + c, 1.0f + 0.7f * c));
+        }
+        bank.setIsa((SimdSpeedBank::Isa)isa);
+
+        srand(3);
+        vector<int32_t> counts(CHANNELS, 0);
+        uint32_t timestamp = 0;
+        size_t mismatches = 0;
+        for (int u = 0; u < 1000; u++) {
+            timestamp += 9000 + rand() % 2000;
+            for (size_t c = 0; c < CHANNELS; c++) {
+                counts[c] += rand() % 201 - 100;
+            }
+            bank.update(counts.data(), timestamp);
+            for (size_t c = 0; c < CHANNELS; c++) {
+                if (estimators[c].estimateSpeed((int)counts[c], timestamp) != bank.speed(c)) {
+                    mismatches++;
+                }
+            }
+        }
+
+        bool pass = (mismatches == 0);
+        cout << "Kernel " << SimdSpeedBank::isaName((SimdSpeedBank::Isa)isa) << endl;
+        cout << "  speeds different from SpeedEstimator = " << mismatches << endl;
+        cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+        failures += pass ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  SIMD Speed Bank Test Suite                                ║" << endl;
+    cout << "║  Vector kernels must match the scalar path exactly         ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    cout << "Detected kernel: " << SimdSpeedBank::isaName(SimdSpeedBank::detectIsa()) << endl;
+
+    int failures = 0;
+    failures += testKernelsMatchScalar();
+    failures += testScalarFormula();
+    failures += testMatchesSpeedEstimator();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
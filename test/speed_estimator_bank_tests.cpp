@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file speed_estimator_bank_tests.cpp
+ * @brief Test cases for SpeedEstimatorBank against one SpeedEstimator per channel, built against the host Arduino shim.
+ * Built by the CMake host build (see CMakeLists.txt).
+ */
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+#include "SpeedEstimator.h"
+#include "SpeedEstimatorBank.h"
+
+using namespace std;
+
+static const uint8_t CHANNELS = 4;
+static const float PPR[CHANNELS] = {22.0f, 11.0f, 1024.0f, 48.0f};
+static const float GEAR_RATIO[CHANNELS] = {9.3f, 10.0f, 4.0f, 30.0f};
+
+static bool check(const char* name, double value, double expected, double tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << " (± " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Largest difference between the bank and per-channel estimators, relative to
+ * the largest speed of the channel.
+ */
+static double maxRelativeDifference(const IIRFilter& filter) {
+    SpeedEstimatorBank<CHANNELS> bank(filter);
+    SpeedEstimator* estimators[CHANNELS];
+    for (uint8_t c = 0; c < CHANNELS; c++) {
+        bank.configure(c, PPR[c], GEAR_RATIO[c]);
+        estimators[c] = new SpeedEstimator(PPR[c], GEAR_RATIO[c], filter);
+    }
+
+    srand(7);
+    int32_t counts[CHANNELS] = {0, 0, 0, 0};
+    double maxDifference[CHANNELS] = {0, 0, 0, 0};
+    double maxSpeed[CHANNELS] = {0, 0, 0, 0};
+    uint32_t timestamp = 0xFFFFFFFFUL - 30000UL; // Across the timestamp wrap
+    for (int u = 0; u < 2000; u++) {
+        timestamp += 9000 + rand() % 2000;
+        for (uint8_t c = 0; c < CHANNELS; c++) {
+            // Both directions, through zero
+            counts[c] += (int32_t)(200.0 * sin(0.01 * u + c)) + rand() % 21 - 10;
+        }
+        bank.update(counts, timestamp);
+        for (uint8_t c = 0; c < CHANNELS; c++) {
+            float reference = estimators[c]->estimateSpeed((int)counts[c], timestamp);
+            maxDifference[c] = fmax(maxDifference[c], fabs((double)bank.speed(c) - (double)reference));
+            maxSpeed[c] = fmax(maxSpeed[c], fabs((double)reference));
+        }
+    }
+
+    double worst = 0;
+    for (uint8_t c = 0; c < CHANNELS; c++) {
+        cout << "  Channel " << (int)c << ": max difference " << maxDifference[c] << " RPM, max speed "
+             << maxSpeed[c] << " RPM" << endl;
+        worst = fmax(worst, maxDifference[c] / maxSpeed[c]);
+        delete estimators[c];
+    }
+    return worst;
+}
+
+// ============================================================================
+// Test 1: Each channel against its own SpeedEstimator
+// ============================================================================
+int testChannelsMatchEstimator() {
+    cout << "\n=== Test 1: SpeedEstimatorBank vs SpeedEstimator ===" << endl;
+    int failures = 0;
+
+    // The shared reciprocal of the elapsed time rounds twice where SpeedEstimator divides once
+    double difference = maxRelativeDifference(IIRFilter());
+    failures += check("Case 1.1: Default filter, within 1e-6 of the largest speed", difference, 0.0, 1e-6) ? 0 : 1;
+
+    difference = maxRelativeDifference(IIRFilter::butterworth1(20.0f, 0.01f));
+    failures += check("Case 1.2: 20 Hz filter, within 1e-6 of the largest speed", difference, 0.0, 1e-6) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Repeated timestamps and reset
+// ============================================================================
+int testStateHandling() {
+    cout << "\n=== Test 2: Repeated timestamps and reset ===" << endl;
+    int failures = 0;
+
+    SpeedEstimatorBank<CHANNELS> bank;
+    bank.configureAll(22.0f, 9.3f);
+    int32_t counts[CHANNELS] = {10, 20, 30, 40};
+    bank.update(counts, 10000);
+    float before = bank.speed(3);
+    counts[3] = 1000;
+    bank.update(counts, 10000);
+    failures += check("Case 2.1: Same timestamp leaves the speeds unchanged", bank.speed(3), before, 0.0) ? 0 : 1;
+
+    bank.reset();
+    float sum = 0;
+    for (uint8_t c = 0; c < CHANNELS; c++) {
+        sum += fabs(bank.speed(c));
+    }
+    failures += check("Case 2.2: reset() clears every channel", sum, 0.0, 0.0) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  SpeedEstimatorBank Test Suite                             ║" << endl;
+    cout << "║  Every channel against a single-channel estimator          ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testChannelsMatchEstimator();
+    failures += testStateHandling();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
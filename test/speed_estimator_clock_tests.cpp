@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file speed_estimator_clock_tests.cpp
+ * @brief Test cases for the clock policies of SpeedEstimatorClock.h, built against the host Arduino shim.
+ * Built by the CMake host build (see CMakeLists.txt).
+ */
+
+#include <iostream>
+#include <cmath>
+#include <type_traits>
+
+#include "SpeedEstimator.h"
+
+using namespace std;
+
+static bool check(const char* name, double value, double expected, double tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << " (± " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Cycle counter set by the test. Each case uses its own Id, so that each
+ * CycleCounterClock instance starts from a fresh state.
+ */
+template <int Id>
+struct FakeCycles {
+    static uint32_t value;
+    static uint32_t read() { return value; }
+};
+template <int Id>
+uint32_t FakeCycles<Id>::value = 0;
+
+// ============================================================================
+// Test 1: Default policy
+// ============================================================================
+int testDefaultClock() {
+    cout << "\n=== Test 1: ArduinoMicrosClock ===" << endl;
+    int failures = 0;
+
+    failures += check("Case 1.1: SpeedEstimatorClock is ArduinoMicrosClock by default",
+                      is_same<SpeedEstimatorClock, ArduinoMicrosClock>::value ? 1 : 0, 1, 0) ? 0 : 1;
+
+    hostSetMicros(0xFFFFFFF0UL);
+    uint32_t before = SpeedEstimatorClock::now();
+    hostAdvanceMicros(0x20);
+    uint32_t after = SpeedEstimatorClock::now();
+    failures += check("Case 1.2a: Follows hostSetMicros()", before, 0xFFFFFFF0UL, 0) ? 0 : 1;
+    failures += check("Case 1.2b: Elapsed time across the wrap", (uint32_t)(after - before), 0x20, 0) ? 0 : 1;
+
+    // Case 1.3: The estimator timestamps with the policy
+    SpeedEstimator speedEstimator(22.0f, 9.3f);
+    hostSetMicros(1000000);
+    speedEstimator.estimateSpeed(0);
+    hostAdvanceMicros(10000);
+    SpeedEstimator reference(22.0f, 9.3f);
+    reference.estimateSpeed(0, 1000000);
+    failures += check("Case 1.3: estimateSpeed(int) uses the clock", speedEstimator.estimateSpeed(10),
+                      reference.estimateSpeed(10, 1010000), 0) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Cycle counter extended to microseconds
+// ============================================================================
+int testCycleCounterClock() {
+    cout << "\n=== Test 2: CycleCounterClock ===" << endl;
+    int failures = 0;
+
+    // Case 2.1: Time since the counter started, like micros()
+    {
+        typedef CycleCounterClock<FakeCycles<1>, 240> Clock;
+        FakeCycles<1>::value = 2400;
+        failures += check("Case 2.1: First call counts from cycle 0", Clock::now(), 10, 0) ? 0 : 1;
+    }
+
+    // Case 2.2: Calls 1000 cycles apart (4.17 us at 240 MHz): the remainders are carried
+    {
+        typedef CycleCounterClock<FakeCycles<2>, 240> Clock;
+        uint32_t time = 0;
+        for (int i = 1; i <= 1000; i++) {
+            FakeCycles<2>::value += 1000;
+            time = Clock::now();
+        }
+        failures += check("Case 2.2: No drift over 1000 calls (us)", time, 1000000 / 240, 0) ? 0 : 1;
+    }
+
+    // Case 2.3: Across the counter wrap, with uneven steps
+    {
+        typedef CycleCounterClock<FakeCycles<3>, 240> Clock;
+        FakeCycles<3>::value = 0xFFF00000UL;
+        uint32_t start = Clock::now();
+        uint64_t cycles = 0;
+        uint32_t seed = 12345;
+        uint32_t time = start;
+        for (int i = 0; i < 100000; i++) {
+            seed = seed * 1103515245UL + 12345UL;
+            uint32_t step = (seed >> 8) % 100000;
+            FakeCycles<3>::value += step;
+            cycles += step;
+            time = Clock::now();
+        }
+        cout << "  Counter wrapped " << (unsigned)((0xFFF00000ULL + cycles) >> 32) << " times" << endl;
+        // The start itself may leave up to one microsecond of cycles in the remainder
+        failures += check("Case 2.3: Elapsed time across counter wraps (us)", (uint32_t)(time - start),
+                          (double)cycles / 240.0, 1.0) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  SpeedEstimatorClock Test Suite                            ║" << endl;
+    cout << "║  Clock policies against the host shim and a fake counter   ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testDefaultClock();
+    failures += testCycleCounterClock();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
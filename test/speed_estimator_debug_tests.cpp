@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file speed_estimator_debug_tests.cpp
+ * @brief Test cases for the optional debug checks of SpeedEstimator.
+ * Built by the CMake host build against the library compiled with the checks enabled
+ * (see CMakeLists.txt), or by hand:
+ * g++ -std=c++11 -DSPEEDESTIMATOR_PERIOD_CHECK=10 -DSPEEDESTIMATOR_INSTRUMENTATION -I.. -I../extras/host speed_estimator_debug_tests.cpp ../[A-Z]*.cpp ../extras/host/Arduino.cpp
+ */
+
+#include <iostream>
+#include <cmath>
+
+#include "SpeedEstimator.h"
+
+using namespace std;
+
+#if !defined(SPEEDESTIMATOR_PERIOD_CHECK) || SPEEDESTIMATOR_PERIOD_CHECK != 10 || !defined(SPEEDESTIMATOR_INSTRUMENTATION)
+#error "Build with -DSPEEDESTIMATOR_PERIOD_CHECK=10 -DSPEEDESTIMATOR_INSTRUMENTATION"
+#endif
+
+static bool check(const char* name, uint32_t value, uint32_t expected) {
+    bool pass = value == expected;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+// ============================================================================
+// Test 1: Period check of the fixed-period mode
+// ============================================================================
+int testPeriodCheck() {
+    cout << "\n=== Test 1: Period check (10 % tolerance) ===" << endl;
+    int failures = 0;
+
+    SpeedEstimator speedEstimator(22.0f, 9.3f);
+    speedEstimator.setFixedPeriod(10000);
+    hostSetMicros(100);
+
+    // Case 1.1: Within the tolerance, the first call only starts the measurement
+    const uint32_t periods[] = {10000, 9000, 11000, 10500};
+    speedEstimator.estimateSpeed(0);
+    for (unsigned i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+        hostAdvanceMicros(periods[i]);
+        speedEstimator.estimateSpeed((int)i);
+    }
+    failures += check("Case 1.1: Periods within 10 % are accepted", speedEstimator.periodDeviations(), 0) ? 0 : 1;
+
+    // Case 1.2: A late call and a call too early are flagged
+    hostAdvanceMicros(11001);
+    speedEstimator.estimateSpeed(10);
+    hostAdvanceMicros(2000);
+    speedEstimator.estimateSpeed(11);
+    failures += check("Case 1.2: Periods of 11.001 ms and 2 ms are flagged", speedEstimator.periodDeviations(), 2) ? 0 : 1;
+    failures += check("Case 1.3: Last measured period", speedEstimator.checkedPeriod(), 2000) ? 0 : 1;
+
+    // Case 1.4: reset() restarts the measurement (a gap before it is not a deviation)
+    hostAdvanceMicros(500000);
+    speedEstimator.reset();
+    speedEstimator.estimateSpeed(0);
+    hostAdvanceMicros(10000);
+    speedEstimator.estimateSpeed(5);
+    failures += check("Case 1.4: No deviation across reset()", speedEstimator.periodDeviations(), 2) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Call timing statistics
+// ============================================================================
+int testInstrumentation() {
+    cout << "\n=== Test 2: Call timing statistics ===" << endl;
+    int failures = 0;
+
+    // Case 2.1: Intervals of the timestamped calls
+    {
+        SpeedEstimator speedEstimator(22.0f, 9.3f);
+        uint32_t timestamp = 1000000;
+        speedEstimator.estimateSpeed(0, timestamp);
+        speedEstimator.resetStats(25000);
+
+        // 8 x 10 ms, a repeated timestamp, a 30 ms gap and a 3 ms call
+        const uint32_t intervals[] = {10000, 10000, 10000, 10000, 10000, 10000, 10000, 10000, 0, 30000, 3000};
+        for (unsigned i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+            timestamp += intervals[i];
+            speedEstimator.estimateSpeed((int)i * 10, timestamp);
+        }
+        const SpeedEstimatorStats& stats = speedEstimator.stats();
+        cout << "  Mean interval: " << stats.meanDeltaTime() << " us, mean cost: " << stats.meanCycles() << " cycles" << endl;
+
+        failures += check("Case 2.1a: Calls", stats.calls, 11) ? 0 : 1;
+        failures += check("Case 2.1b: Zero-interval calls", stats.zeroDeltaTimeCalls, 1) ? 0 : 1;
+        failures += check("Case 2.1c: Overlong calls (> 25 ms)", stats.overlongDeltaTimeCalls, 1) ? 0 : 1;
+        failures += check("Case 2.1d: Min interval", stats.minDeltaTime, 3000) ? 0 : 1;
+        failures += check("Case 2.1e: Max interval", stats.maxDeltaTime, 30000) ? 0 : 1;
+        failures += check("Case 2.1f: Mean interval (113000 / 10)", (uint32_t)stats.meanDeltaTime(), 11300) ? 0 : 1;
+        // 3000 in [2048, 4096), 10000 in [8192, 16384), 30000 in [16384, 32768)
+        failures += check("Case 2.1g: Histogram bins 11, 13, 14",
+                          stats.histogram[11] * 10000 + stats.histogram[13] * 100 + stats.histogram[14], 10801) ? 0 : 1;
+        failures += check("Case 2.1h: Cycle cost recorded",
+                          stats.maxCycles >= stats.minCycles && stats.sumCycles >= stats.maxCycles ? 1 : 0, 1) ? 0 : 1;
+    }
+
+    // Case 2.2: Period and M/T modes record the interval since the previous sample
+    {
+        SpeedEstimator speedEstimator(22.0f, 9.3f);
+        hostSetMicros(5000000);
+        speedEstimator.estimateSpeedMT(0, 0);
+        speedEstimator.resetStats();
+        hostAdvanceMicros(10000);
+        speedEstimator.estimateSpeedMT(10, micros() - 100);
+        hostAdvanceMicros(20000);
+        speedEstimator.estimateSpeedFromPeriod(20, micros() - 100, 1000);
+        hostAdvanceMicros(20000);
+        speedEstimator.estimateSpeedFromPeriod(20, micros() - 100, 1000);
+        const SpeedEstimatorStats& stats = speedEstimator.stats();
+        failures += check("Case 2.2a: Calls", stats.calls, 3) ? 0 : 1;
+        failures += check("Case 2.2b: M/T interval", stats.minDeltaTime, 10000) ? 0 : 1;
+        failures += check("Case 2.2c: Period-mode interval", stats.maxDeltaTime, 20000) ? 0 : 1;
+        failures += check("Case 2.2d: Sum of the intervals", stats.sumDeltaTime, 50000) ? 0 : 1;
+        failures += check("Case 2.2e: Overlong calls (> 20 ms)", stats.overlongDeltaTimeCalls, 0) ? 0 : 1;
+    }
+
+    // Case 2.3: Fixed-period mode, measured with the clock
+    {
+        SpeedEstimator speedEstimator(22.0f, 9.3f);
+        hostSetMicros(7000000);
+        speedEstimator.estimateSpeed(0, micros());
+        speedEstimator.resetStats();
+        speedEstimator.setFixedPeriod(1000);
+        for (int i = 0; i < 6; i++) {
+            hostAdvanceMicros(1000);
+            speedEstimator.estimateSpeed(1 + i); // The first call has no interval: not recorded
+        }
+        const SpeedEstimatorStats& stats = speedEstimator.stats();
+        failures += check("Case 2.3a: Calls after the first one", stats.calls, 5) ? 0 : 1;
+        failures += check("Case 2.3b: Intervals from the clock",
+                          stats.minDeltaTime == 1000 && stats.maxDeltaTime == 1000 ? 1 : 0, 1) ? 0 : 1;
+
+        // Case 2.3c: Setting the period again starts over
+        hostAdvanceMicros(500000);
+        speedEstimator.setFixedPeriod(1000);
+        speedEstimator.estimateSpeed(10);
+        failures += check("Case 2.3c: No 500 ms interval after setFixedPeriod()", stats.maxDeltaTime, 1000) ? 0 : 1;
+    }
+
+    // Case 2.4: CPU-tick timestamps (16 MHz) are recorded in microseconds
+    {
+        SpeedEstimator speedEstimator(22.0f, 9.3f);
+        speedEstimator.setTimestampRate(16000000UL);
+        uint32_t ticks = 16000000;
+        speedEstimator.estimateSpeed(0, ticks);
+        speedEstimator.resetStats(25000);
+        ticks += 16 * 10000;
+        speedEstimator.estimateSpeed(10, ticks);
+        ticks += 16 * 30000;
+        speedEstimator.estimateSpeed(20, ticks);
+        const SpeedEstimatorStats& stats = speedEstimator.stats();
+        failures += check("Case 2.4a: Min interval (us)", stats.minDeltaTime, 10000) ? 0 : 1;
+        failures += check("Case 2.4b: Max interval (us)", stats.maxDeltaTime, 30000) ? 0 : 1;
+        failures += check("Case 2.4c: Overlong calls (> 25 ms)", stats.overlongDeltaTimeCalls, 1) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  SpeedEstimator Debug Checks Test Suite                    ║" << endl;
+    cout << "║  Library built with the optional checks enabled            ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testPeriodCheck();
+    failures += testInstrumentation();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file speed_estimator_q_tests.cpp
+ * @brief Test cases for SpeedEstimatorQ against the float SpeedEstimator, built against the host Arduino shim.
+ * Built by the CMake host build (see CMakeLists.txt).
+ */
+
+#include <iostream>
+#include <cmath>
+#include <climits>
+#include <vector>
+
+#include "SpeedEstimator.h"
+#include "SpeedEstimatorQ.h"
+
+using namespace std;
+
+static bool check(const char* name, double value, double expected, double tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << " (± " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Timestamped encoder samples.
+ */
+struct Trace {
+    vector<int> counts;
+    vector<uint32_t> timestamps;
+};
+
+/**
+ * @brief Counts of an encoder following a speed profile, read every periodMicros
+ * with a deterministic jitter of up to +/- jitterMicros.
+ */
+static Trace makeTrace(double (*rpm)(double t), size_t n, double countsPerRev, uint32_t periodMicros,
+                       uint32_t jitterMicros) {
+    Trace trace;
+    uint32_t seed = 12345;
+    double position = 0.5;
+    double t = 0;
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1103515245UL + 12345UL;
+        int32_t jitter = (jitterMicros == 0) ? 0 : (int32_t)((seed >> 8) % (2 * jitterMicros + 1)) - (int32_t)jitterMicros;
+        double dt = (double)((int32_t)periodMicros + jitter) * 1e-6;
+        // Trapezoidal integration of the speed to counts
+        position += 0.5 * (rpm(t) + rpm(t + dt)) / 60.0 * countsPerRev * dt;
+        t += dt;
+        trace.counts.push_back((int)floor(position));
+        trace.timestamps.push_back((uint32_t)llround(t * 1e6));
+    }
+    return trace;
+}
+
+// Direction changes every second, with a slow approach to zero
+static double reversingSpeed(double t) { return 400.0 * sin(M_PI * t) + 20.0 * sin(7.0 * t); }
+
+// Full stop from 300 RPM, then creep
+static double stoppingSpeed(double t) { return (t < 1.0) ? 300.0 : (t < 1.5) ? 0.0 : 0.5; }
+
+static double highSpeed(double) { return 25000.0; }
+
+/**
+ * @brief Tolerance stated in SpeedEstimatorQ.h: relative part.
+ */
+static double statedEpsilon(float ppr, float gearRatio, const IIRFilter& filter, uint32_t maxDeltaTime,
+                            uint8_t scaleShift) {
+    double scale = 60.0e6 / ((double)ppr * (double)gearRatio);
+    return (double)maxDeltaTime / (scale * ldexp(1.0, scaleShift)) +
+           ldexp(1.0, -16) * (1.0 / filter.b0() + 1.0 / (1.0 + filter.a1()));
+}
+
+/**
+ * @brief Largest excess of |fixed - float| over the stated bound on a trace.
+ *
+ * The bound is relative to the float filter applied to the magnitude of the raw
+ * velocity, obtained by feeding a second SpeedEstimator the absolute count changes.
+ */
+static double boundExcess(float ppr, float gearRatio, const IIRFilter& filter, const Trace& trace,
+                          uint32_t maxDeltaTime, double* maxError) {
+    SpeedEstimator reference(ppr, gearRatio, filter);
+    SpeedEstimator envelope(ppr, gearRatio, filter);
+    SpeedEstimatorQ fixed(ppr, gearRatio, filter);
+    double epsilon = statedEpsilon(ppr, gearRatio, filter, maxDeltaTime, fixed.scaleShift());
+    double absolute = ldexp(1.0, -15) / (1.0 + filter.a1());
+
+    double excess = -1e9;
+    *maxError = 0;
+    int absCount = 0;
+    for (size_t i = 0; i < trace.counts.size(); i++) {
+        absCount += abs(trace.counts[i] - (i > 0 ? trace.counts[i - 1] : 0));
+        float f = reference.estimateSpeed(trace.counts[i], trace.timestamps[i]);
+        float magnitude = envelope.estimateSpeed(absCount, trace.timestamps[i]);
+        float q = SpeedEstimatorQ::toFloat(fixed.estimateSpeedQ(trace.counts[i], trace.timestamps[i]));
+        double error = fabs((double)q - (double)f);
+        *maxError = fmax(*maxError, error);
+        excess = fmax(excess, error - (epsilon * magnitude + absolute));
+    }
+    return excess;
+}
+
+// ============================================================================
+// Test 1: Tolerance against the float estimator
+// ============================================================================
+int testTolerance() {
+    cout << "\n=== Test 1: SpeedEstimatorQ vs SpeedEstimator ===" << endl;
+    int failures = 0;
+    double maxError;
+
+    // Case 1.1: Default filter, 10 ms with jitter, through zero speed several times
+    {
+        Trace trace = makeTrace(reversingSpeed, 1000, 22.0 * 9.3, 10000, 2000);
+        double excess = boundExcess(22.0f, 9.3f, IIRFilter(), trace, 12000, &maxError);
+        cout << "  Max difference: " << maxError << " RPM" << endl;
+        failures += check("Case 1.1: Within the stated bound across direction changes", fmax(excess, 0.0), 0.0, 0.0)
+                    ? 0 : 1;
+    }
+
+    // Case 1.2: Narrow filter (1 Hz at 1 kHz), with a full stop
+    {
+        IIRFilter filter = IIRFilter::butterworth1(1.0f, 0.001f);
+        Trace trace = makeTrace(stoppingSpeed, 4000, 22.0 * 9.3, 1000, 100);
+        double excess = boundExcess(22.0f, 9.3f, filter, trace, 1100, &maxError);
+        cout << "  Max difference: " << maxError << " RPM" << endl;
+        failures += check("Case 1.2: Within the stated bound with a 1 Hz filter and a stop", fmax(excess, 0.0), 0.0,
+                          0.0) ? 0 : 1;
+    }
+
+    // Case 1.3: 25000 RPM with ppr 22 and gear 1. Every 10th read is stale, so the next
+    // one sees twice the pulses: raw velocities of 50000 RPM, beyond the Q16.16 range
+    {
+        Trace trace = makeTrace(highSpeed, 1000, 22.0, 1000, 0);
+        for (size_t i = 9; i + 1 < trace.counts.size(); i += 10) {
+            trace.counts[i] = trace.counts[i - 1];
+        }
+        double excess = boundExcess(22.0f, 1.0f, IIRFilter(), trace, 1000, &maxError);
+        cout << "  Max difference: " << maxError << " RPM" << endl;
+        failures += check("Case 1.3: Raw velocities above 32767 RPM are filtered, not saturated", fmax(excess, 0.0),
+                          0.0, 0.0) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Range limits
+// ============================================================================
+int testRange() {
+    cout << "\n=== Test 2: Saturation and counter wrap ===" << endl;
+    int failures = 0;
+
+    // Case 2.1: A filtered speed beyond the range saturates with its sign
+    {
+        SpeedEstimatorQ forward(22.0f, 1.0f);
+        SpeedEstimatorQ backward(22.0f, 1.0f);
+        int32_t up = 0, down = 0;
+        for (int i = 1; i <= 200; i++) {
+            // 60000 RPM: 22 pulses per ms
+            up = forward.estimateSpeedQ(22 * i, 1000U * (uint32_t)i);
+            down = backward.estimateSpeedQ(-22 * i, 1000U * (uint32_t)i);
+        }
+        failures += check("Case 2.1a: Positive saturation", SpeedEstimatorQ::toFloat(up), 32768.0, 1.0) ? 0 : 1;
+        failures += check("Case 2.1b: Negative saturation", SpeedEstimatorQ::toFloat(down), -32768.0, 1.0) ? 0 : 1;
+    }
+
+    // Case 2.2: Counter wrap-around
+    {
+        Trace trace = makeTrace(reversingSpeed, 500, 22.0 * 9.3, 10000, 2000);
+        SpeedEstimatorQ plain(22.0f, 9.3f);
+        SpeedEstimatorQ wrapped(22.0f, 9.3f);
+        const unsigned int OFFSET = (unsigned int)INT_MAX - 700U;
+        // Starting counts, taken over an interval so long that one pulse is 0 RPM
+        plain.estimateSpeedQ(0, 0xFFFFFFFFUL);
+        wrapped.estimateSpeedQ((int)OFFSET, 0xFFFFFFFFUL);
+        bool same = true;
+        for (size_t i = 0; i < trace.counts.size(); i++) {
+            int shifted = (int)((unsigned int)trace.counts[i] + OFFSET);
+            same = same && plain.estimateSpeedQ(trace.counts[i], trace.timestamps[i]) ==
+                           wrapped.estimateSpeedQ(shifted, trace.timestamps[i]);
+        }
+        failures += check("Case 2.2: Identical output across the counter wrap", same ? 1 : 0, 1, 0) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  SpeedEstimatorQ Test Suite                                ║" << endl;
+    cout << "║  Fixed point against the float estimator                   ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testTolerance();
+    failures += testRange();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,427 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file speed_estimator_tests.cpp
+ * @brief Test cases for the SpeedEstimator class itself, built against the host Arduino shim.
+ * Built by the CMake host build (see CMakeLists.txt), or by hand:
+ * g++ -std=c++11 -I.. -I../extras/host speed_estimator_tests.cpp ../[A-Z]*.cpp ../extras/host/Arduino.cpp
+ */
+
+#include <iostream>
+#include <cmath>
+#include <climits>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+#include "SpeedEstimator.h"
+#include "SpeedEstimatorT.h"
+#include "QuadratureDecoder.h"
+
+using namespace std;
+
+static const float PPR = 22.0f;
+static const float GEAR_RATIO = 9.3f;
+
+/**
+ * @brief Speed in RPM of a constant pulse rate.
+ */
+static float expectedRpm(int pulsesPerPeriod, uint32_t periodMicros) {
+    return (float)pulsesPerPeriod * 60.0e6f / (PPR * GEAR_RATIO) / (float)periodMicros;
+}
+
+static bool check(const char* name, float value, float expected, float tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Speed: " << value << " RPM" << endl;
+    cout << "  Expected: " << expected << " RPM (+/- " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+// ============================================================================
+// Test 1: Constant speed with the clock read through micros()
+// ============================================================================
+int testConstantSpeed() {
+    cout << "\n=== Test 1: Constant speed (micros() from the shim) ===" << endl;
+    int failures = 0;
+
+    // Case 1.1: Steady state (the default filter has a DC gain of 0.9996)
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        hostSetMicros(1000);
+        int pulses = 0;
+        float speed = 0;
+        for (int i = 0; i < 200; i++) {
+            hostAdvanceMicros(10000);
+            pulses += 100;
+            speed = speedEstimator.estimateSpeed(pulses);
+        }
+        float expected = expectedRpm(100, 10000);
+        failures += check("Case 1.1: 100 pulses every 10 ms", speed, expected, expected * 1e-3f) ? 0 : 1;
+    }
+
+    // Case 1.2: micros() wraps around during the run
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        hostSetMicros(1000);
+        speedEstimator.estimateSpeed(0);
+        hostSetMicros(0xFFFFFFFFUL - 500000UL);
+        speedEstimator.estimateSpeed(0); // Resynchronizes the timestamp
+        speedEstimator.reset();
+        speedEstimator.estimateSpeed(0, micros());
+        int pulses = 0;
+        float speed = 0;
+        for (int i = 0; i < 200; i++) {
+            hostAdvanceMicros(10000);
+            pulses -= 50;
+            speed = speedEstimator.estimateSpeed(pulses);
+        }
+        float expected = expectedRpm(-50, 10000);
+        failures += check("Case 1.2: micros() wrap, reverse direction", speed, expected, fabs(expected) * 1e-3f) ? 0 : 1;
+    }
+
+    // Case 1.3: The pulse counter wraps around INT_MAX
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        uint32_t timestamp = 5000;
+        unsigned int pulses = (unsigned int)INT_MAX - 5000U;
+        speedEstimator.estimateSpeed((int)pulses, timestamp);
+        float speed = 0;
+        for (int i = 0; i < 200; i++) {
+            timestamp += 10000;
+            pulses += 100;
+            speed = speedEstimator.estimateSpeed((int)pulses, timestamp);
+        }
+        float expected = expectedRpm(100, 10000);
+        failures += check("Case 1.3: Pulse counter wrap", speed, expected, expected * 1e-3f) ? 0 : 1;
+    }
+
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Repeated timestamps and reset
+// ============================================================================
+int testStateHandling() {
+    cout << "\n=== Test 2: Repeated timestamps and reset ===" << endl;
+    int failures = 0;
+
+    SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+    float speed = speedEstimator.estimateSpeed(100, 10000);
+    float repeated = speedEstimator.estimateSpeed(5000, 10000);
+    failures += check("Case 2.1: Same timestamp returns the previous output", repeated, speed, 0.0f) ? 0 : 1;
+
+    speedEstimator.reset();
+    speed = speedEstimator.estimateSpeed(0, 20000);
+    failures += check("Case 2.2: No pulses after reset", speed, 0.0f, 0.0f) ? 0 : 1;
+
+    return failures;
+}
+
+// ============================================================================
+// Test 3: Batch processing against per-sample calls
+// ============================================================================
+int testBatch() {
+    cout << "\n=== Test 3: estimateSpeedBatch vs estimateSpeed ===" << endl;
+
+    const size_t SAMPLES = 10000;
+    vector<int32_t> counts(SAMPLES);
+    vector<uint32_t> timestamps(SAMPLES);
+    uint32_t timestamp = 0xFFFFFFFFUL - 100000UL;
+    int32_t count = 0;
+    for (size_t i = 0; i < SAMPLES; i++) {
+        timestamp += (i == 4321) ? 0 : 9000 + (uint32_t)(i * 7919 % 2000);
+        count += (int32_t)(i * 104729 % 61) - 20;
+        counts[i] = count;
+        timestamps[i] = timestamp;
+    }
+
+    SpeedEstimator sequential(PPR, GEAR_RATIO, IIRFilter::butterworth2(10.0f, 0.01f));
+    SpeedEstimator batch(PPR, GEAR_RATIO, IIRFilter::butterworth2(10.0f, 0.01f));
+    vector<float> out(SAMPLES);
+    // Uneven chunks, including one with the repeated timestamp
+    const size_t CHUNKS[] = {1, 999, 3000, 4000, 2000};
+    size_t start = 0;
+    for (size_t length : CHUNKS) {
+        batch.estimateSpeedBatch(&counts[start], &timestamps[start], &out[start], length);
+        start += length;
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < SAMPLES; i++) {
+        if (sequential.estimateSpeed((int)counts[i], timestamps[i]) != out[i]) {
+            mismatches++;
+        }
+    }
+
+    bool pass = (mismatches == 0);
+    cout << "  samples = " << SAMPLES << ", mismatches = " << mismatches << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass ? 0 : 1;
+}
+
+// ============================================================================
+// Test 4: Quadrature decoder driven through the simulated pins
+// ============================================================================
+QuadratureDecoder decoder(2, 3, QUADRATURE_4X);
+EncoderSnapshot encoder;
+
+void readEncoder() {
+    int8_t step = decoder.update();
+    if (step != 0) {
+        encoder.increment(step, micros());
+    }
+}
+
+int testQuadratureSpeed() {
+    cout << "\n=== Test 4: QuadratureDecoder + EncoderSnapshot + M/T ===" << endl;
+
+    hostSetPin(2, LOW);
+    hostSetPin(3, LOW);
+    decoder.begin();
+    decoder.attach(readEncoder);
+
+    // Gray sequence of A/B, forward: 00 -> 10 -> 11 -> 01
+    const uint8_t A[4] = {1, 1, 0, 0};
+    const uint8_t B[4] = {0, 1, 1, 0};
+    SpeedEstimator speedEstimator(PPR * 4.0f, GEAR_RATIO);
+    hostSetMicros(0);
+    float speed = 0;
+    int phase = 0;
+    for (int sample = 0; sample < 300; sample++) {
+        // 10 counts per 10 ms sample, one every 1 ms
+        for (int edge = 0; edge < 10; edge++) {
+            hostAdvanceMicros(1000);
+            hostSetPin(2, A[phase]);
+            hostSetPin(3, B[phase]);
+            phase = (phase + 1) % 4;
+        }
+        speed = speedEstimator.estimateSpeed(encoder);
+    }
+    decoder.detach();
+
+    float expected = 10.0f * 60.0e6f / (PPR * 4.0f * GEAR_RATIO) / 10000.0f;
+    int failures = 0;
+    failures += check("Case 4.1: Counts decoded from the pins", (float)decoder.count(), 3000.0f, 0.0f) ? 0 : 1;
+    failures += check("Case 4.2: M/T speed from the snapshot", speed, expected, expected * 1e-3f) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 5: Fixed-period mode
+// ============================================================================
+int testFixedPeriod() {
+    cout << "\n=== Test 5: Fixed-period mode ===" << endl;
+    int failures = 0;
+
+    // Case 5.1: Same speeds as the measured interval when the period is exact
+    {
+        SpeedEstimator measured(PPR, GEAR_RATIO);
+        SpeedEstimator fixed(PPR, GEAR_RATIO);
+        fixed.setFixedPeriod(10000);
+        uint32_t timestamp = 0;
+        int pulses = 0;
+        float maxError = 0;
+        for (int i = 0; i < 500; i++) {
+            timestamp += 10000;
+            pulses += (i % 7) * 13 - 20;
+            float reference = measured.estimateSpeed(pulses, timestamp);
+            float speed = fixed.estimateSpeed(pulses);
+            float error = fabs(speed - reference) / (fabs(reference) + 1.0f);
+            if (error > maxError) {
+                maxError = error;
+            }
+        }
+        cout << "  Max relative difference: " << maxError << endl;
+        failures += check("Case 5.1: Matches the measured-interval path", maxError, 0.0f, 1e-5f) ? 0 : 1;
+    }
+
+    // Case 5.2: The clock is not read (a frozen micros() would otherwise give no update)
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        speedEstimator.setFixedPeriod(10000);
+        hostSetMicros(12345);
+        int pulses = 0;
+        float speed = 0;
+        for (int i = 0; i < 200; i++) {
+            pulses += 100;
+            speed = speedEstimator.estimateSpeed(pulses);
+        }
+        float expected = expectedRpm(100, 10000);
+        failures += check("Case 5.2: Speed from the nominal period, clock frozen", speed, expected, expected * 1e-3f) ? 0 : 1;
+    }
+
+    // Case 5.3: Scale follows setTimestampRate(), and 0 measures the interval again
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        speedEstimator.setTimestampRate(16000000UL);
+        speedEstimator.setFixedPeriod(1000);
+        float first = speedEstimator.estimateSpeed(10);
+        float expected = 0.1367f * expectedRpm(10, 1000); // First output of the default filter
+        failures += check("Case 5.3a: Period in microseconds with CPU-tick timestamps", first, expected, expected * 1e-4f) ? 0 : 1;
+
+        speedEstimator.setFixedPeriod(0);
+        speedEstimator.reset();
+        hostSetMicros(5000);
+        speedEstimator.estimateSpeed(0);
+        float frozen = speedEstimator.estimateSpeed(100); // Same micros(): no new sample
+        failures += check("Case 5.3b: setFixedPeriod(0) measures the interval again", frozen, 0.0f, 0.0f) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 6: Instrumentation compiled out by default
+// ============================================================================
+template <class T>
+static auto hasStats(int) -> decltype(declval<T>().stats(), true) { return true; }
+
+template <class T>
+static bool hasStats(...) { return false; }
+
+int testInstrumentationDisabled() {
+    cout << "\n=== Test 6: Instrumentation disabled ===" << endl;
+    int failures = 0;
+    bool pass = !hasStats<SpeedEstimator>(0);
+    cout << "Case 6.1: No stats() without SPEEDESTIMATOR_INSTRUMENTATION" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    failures += pass ? 0 : 1;
+
+    // Case 6.2: The layout without debug members has its own namespace, so it does not
+    // link against a library built with the debug flags
+    pass = is_same<SpeedEstimator, layout_default::SpeedEstimator>::value;
+    cout << "Case 6.2: Default layout namespace" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    failures += pass ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 7: M/T mode with fewer than one edge per window
+// ============================================================================
+int testSlowMT() {
+    cout << "\n=== Test 7: M/T mode, fewer than one edge per window ===" << endl;
+    int failures = 0;
+
+    // Case 7.1: No speed until an edge span has been measured
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        float first = speedEstimator.estimateSpeedMT(5, 12000, 13000);
+        float second = speedEstimator.estimateSpeedMT(5, 12000, 23000);
+        failures += check("Case 7.1a: First edge after construction", first, 0.0f, 0.0f) ? 0 : 1;
+        failures += check("Case 7.1b: No edge yet since the first one", second, 0.0f, 0.0f) ? 0 : 1;
+    }
+
+    // Case 7.2: One edge every 35 ms, sampled every 10 ms: the windows without an edge
+    // keep the last period instead of the (shorter) time since the last edge
+    {
+        SpeedEstimator speedEstimator(PPR, GEAR_RATIO);
+        const uint32_t EDGE_PERIOD = 35000;
+        int pulses = 0;
+        uint32_t lastEdge = 0;
+        float speed = 0, maxSpeed = 0;
+        for (uint32_t now = 10000; now <= 3000000; now += 10000) {
+            while (lastEdge + EDGE_PERIOD <= now) {
+                lastEdge += EDGE_PERIOD;
+                pulses++;
+            }
+            speed = speedEstimator.estimateSpeedMT(pulses, lastEdge, now);
+            if (now > 1000000 && speed > maxSpeed) {
+                maxSpeed = speed;
+            }
+        }
+        float expected = expectedRpm(1, EDGE_PERIOD);
+        failures += check("Case 7.2a: Speed at 1 edge per 3.5 windows", speed, expected, expected * 1e-3f) ? 0 : 1;
+        failures += check("Case 7.2b: No overestimate between edges", maxSpeed, expected, expected * 1e-3f) ? 0 : 1;
+
+        // Case 7.3: Encoder stopped: the speed decays, then is zero after the timeout
+        uint32_t now = lastEdge;
+        for (int i = 0; i < 150; i++) {
+            now += 10000;
+            speed = speedEstimator.estimateSpeedMT(pulses, lastEdge, now);
+        }
+        failures += check("Case 7.3: Zero after the period timeout", speed, 0.0f, 0.01f) ? 0 : 1;
+    }
+
+    // Case 7.4: The timeout is set in microseconds whatever the timestamp rate: with
+    // 16 MHz timestamps, the same output as with microseconds
+    {
+        SpeedEstimator cpuTicks(PPR, GEAR_RATIO);
+        SpeedEstimator reference(PPR, GEAR_RATIO);
+        cpuTicks.setTimestampRate(16000000UL);
+        cpuTicks.setPeriodTimeout(50000);
+        reference.setPeriodTimeout(50000);
+        // One pulse per ms up to 100 ms, then none: zero from 150 ms on (3.125 ms if read as ticks)
+        const int counts[] = {0, 50, 100, 100, 100, 100};
+        const uint32_t edges[] = {0, 50000, 100000, 100000, 100000, 100000};
+        const uint32_t times[] = {100, 50000, 100000, 140000, 160000, 170000};
+        bool same = true;
+        for (int i = 0; i < 6; i++) {
+            float a = cpuTicks.estimateSpeedMT(counts[i], edges[i] * 16, times[i] * 16);
+            float b = reference.estimateSpeedMT(counts[i], edges[i], times[i]);
+            cout << "  " << times[i] / 1000 << " ms: " << a << " / " << b << " RPM" << endl;
+            same = same && fabsf(a - b) <= fabsf(b) * 1e-5f;
+        }
+        failures += check("Case 7.4: Same output with 16 MHz timestamps", same ? 1.0f : 0.0f, 1.0f, 0.0f) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 8: SpeedEstimatorT against SpeedEstimator
+// ============================================================================
+int testCompileTimeEstimator() {
+    cout << "\n=== Test 8: SpeedEstimatorT vs SpeedEstimator ===" << endl;
+    SpeedEstimatorT<22, 93, 10, 10000> compileTime;
+    SpeedEstimatorT<22, 93, 10, 10000> compileTimeMeasured;
+    SpeedEstimator fixed(PPR, GEAR_RATIO);
+    fixed.setFixedPeriod(10000);
+    SpeedEstimator measured(PPR, GEAR_RATIO);
+
+    int pulses = 0;
+    uint32_t timestamp = 0;
+    int fixedMismatches = 0, measuredMismatches = 0;
+    for (int i = 0; i < 500; i++) {
+        pulses += (i % 11) * 9 - 40;
+        timestamp += 9000 + (i % 5) * 500;
+        fixedMismatches += (compileTime.estimateSpeed(pulses) != fixed.estimateSpeed(pulses)) ? 1 : 0;
+        measuredMismatches += (compileTimeMeasured.estimateSpeed(pulses, timestamp) !=
+                               measured.estimateSpeed(pulses, timestamp)) ? 1 : 0;
+    }
+
+    int failures = 0;
+    failures += check("Case 8.1: Same speeds as the fixed-period mode at 10 ms (mismatches)",
+                      (float)fixedMismatches, 0.0f, 0.0f) ? 0 : 1;
+    failures += check("Case 8.2: Same speeds with measured intervals (mismatches)",
+                      (float)measuredMismatches, 0.0f, 0.0f) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  SpeedEstimator Test Suite                                 ║" << endl;
+    cout << "║  The real class on the host Arduino shim                   ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testConstantSpeed();
+    failures += testStateHandling();
+    failures += testBatch();
+    failures += testQuadratureSpeed();
+    failures += testFixedPeriod();
+    failures += testInstrumentationDisabled();
+    failures += testSlowMT();
+    failures += testCompileTimeEstimator();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
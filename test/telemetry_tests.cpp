@@ -0,0 +1,388 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file telemetry_tests.cpp
+ * @brief Test cases for the binary telemetry frames (COBS framing, CRC, stream decoding)
+ * and the lock-free telemetry buffer.
+ * Built by the CMake host build (see CMakeLists.txt), or by hand:
+ * g++ -std=c++11 -I.. -I../extras/host telemetry_tests.cpp ../[A-Z]*.cpp ../extras/host/Arduino.cpp
+ *
+ * With a file name as argument, the stream of Test 4 is also written to that file, to
+ * check extras/telemetry/decode_telemetry.py against it.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "Telemetry.h"
+#include "TelemetryBuffer.h"
+#include "SpeedEstimator.h"
+
+using namespace std;
+
+static bool check(const char* name, bool pass) {
+    cout << name << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+static bool sameSample(const TelemetrySample& a, const TelemetrySample& b) {
+    // Bitwise comparison of the floats (NaN and -0 included)
+    return memcmp(&a.timestamp, &b.timestamp, sizeof(a.timestamp)) == 0 &&
+           memcmp(&a.count, &b.count, sizeof(a.count)) == 0 &&
+           memcmp(&a.rawSpeed, &b.rawSpeed, sizeof(a.rawSpeed)) == 0 &&
+           memcmp(&a.speed, &b.speed, sizeof(a.speed)) == 0;
+}
+
+static void appendFrame(vector<uint8_t>& stream, const TelemetrySample& sample, uint8_t sequence) {
+    uint8_t frame[TelemetryFrame::FRAME_SIZE];
+    uint8_t length = TelemetryFrame::encode(sample, sequence, frame);
+    stream.insert(stream.end(), frame, frame + length);
+}
+
+// ============================================================================
+// Test 1: Frame format
+// ============================================================================
+int testFrameFormat() {
+    cout << "\n=== Test 1: Frame format ===" << endl;
+    int failures = 0;
+
+    // Case 1.1: Check value of CRC-16/CCITT-FALSE
+    {
+        const char* text = "123456789";
+        uint16_t crc = TelemetryFrame::crc16((const uint8_t*)text, 9);
+        cout << "  CRC: 0x" << hex << crc << dec << " (expected 0x29b1)" << endl;
+        failures += check("Case 1.1: CRC of \"123456789\"", crc == 0x29B1) ? 0 : 1;
+    }
+
+    // Case 1.2: Fixed size, little-endian payload, zeros only as delimiter
+    {
+        TelemetrySample sample = {0x04030201UL, 0, 0.0f, 0.0f}; // Mostly zero bytes
+        uint8_t frame[TelemetryFrame::FRAME_SIZE];
+        uint8_t length = TelemetryFrame::encode(sample, 0, frame);
+        bool pass = length == 21 && frame[length - 1] == 0;
+        for (uint8_t i = 0; i + 1 < length; i++) {
+            pass = pass && frame[i] != 0;
+        }
+        // Sequence 0 is stuffed: overhead byte 1, then the timestamp bytes in order
+        pass = pass && frame[0] == 1 && frame[1] == 5 && frame[2] == 1 && frame[3] == 2 && frame[4] == 3 && frame[5] == 4;
+        cout << "  Frame length: " << (int)length << " bytes (expected 21)" << endl;
+        failures += check("Case 1.2: 21 bytes, single zero delimiter at the end", pass) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Round trip
+// ============================================================================
+int testRoundTrip() {
+    cout << "\n=== Test 2: Round trip ===" << endl;
+    const TelemetrySample samples[] = {
+        {0, 0, 0.0f, 0.0f},
+        {0xFFFFFFFFUL, -1, -0.0f, 1.0e-30f},
+        {123456789UL, -2147483647 - 1, 293.25f, -293.125f},
+        {10000, 2147483647, INFINITY, NAN},
+        {0x00FF00FFUL, 0x00010000, 1.5f, 65536.0f},
+    };
+    int failures = 0;
+    bool pass = true;
+    for (unsigned s = 0; s < sizeof(samples) / sizeof(samples[0]); s++) {
+        for (int sequence = 0; sequence < 256; sequence += 51) {
+            uint8_t frame[TelemetryFrame::FRAME_SIZE];
+            uint8_t length = TelemetryFrame::encode(samples[s], (uint8_t)sequence, frame);
+            TelemetrySample decoded = {1, 1, 1.0f, 1.0f};
+            uint8_t decodedSequence = 0;
+            bool ok = TelemetryFrame::decode(frame, length, decoded, decodedSequence);
+            pass = pass && ok && sameSample(decoded, samples[s]) && decodedSequence == sequence;
+        }
+    }
+    failures += check("Case 2.1: Samples and sequence numbers survive encode/decode bit for bit", pass) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 3: Corruption is detected
+// ============================================================================
+int testCorruption() {
+    cout << "\n=== Test 3: Corruption ===" << endl;
+    int failures = 0;
+
+    TelemetrySample sample = {5000000UL, 12345, 150.5f, 149.75f};
+    uint8_t frame[TelemetryFrame::FRAME_SIZE];
+    uint8_t length = TelemetryFrame::encode(sample, 42, frame);
+
+    // Case 3.1: Every single-bit error in the frame body is rejected
+    {
+        int accepted = 0;
+        for (uint8_t i = 0; i + 1 < length; i++) {
+            for (int bit = 0; bit < 8; bit++) {
+                uint8_t corrupted[TelemetryFrame::FRAME_SIZE];
+                memcpy(corrupted, frame, length);
+                corrupted[i] ^= (uint8_t)(1 << bit);
+                TelemetrySample decoded;
+                uint8_t sequence;
+                accepted += TelemetryFrame::decode(corrupted, length, decoded, sequence) ? 1 : 0;
+            }
+        }
+        cout << "  Accepted corrupted frames: " << accepted << " of " << (length - 1) * 8 << endl;
+        failures += check("Case 3.1: All single-bit errors detected", accepted == 0) ? 0 : 1;
+    }
+
+    // Case 3.2: Truncated frames are rejected
+    {
+        int accepted = 0;
+        for (uint8_t n = 0; n + 1 < length; n++) {
+            TelemetrySample decoded;
+            uint8_t sequence;
+            accepted += TelemetryFrame::decode(frame, n, decoded, sequence) ? 1 : 0;
+        }
+        failures += check("Case 3.2: Truncated frames rejected", accepted == 0) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 4: Stream decoding with garbage, a corrupted and a dropped frame
+// ============================================================================
+int testStream(const char* capturePath) {
+    cout << "\n=== Test 4: Stream decoding ===" << endl;
+
+    // The receiver starts in the middle of a frame
+    vector<uint8_t> stream;
+    appendFrame(stream, TelemetrySample{1, 2, 3.0f, 4.0f}, 200);
+    stream.erase(stream.begin(), stream.begin() + 7);
+
+    const int FRAMES = 1000;
+    for (int i = 0; i < FRAMES; i++) {
+        if (i == 500) {
+            continue; // Dropped by the sender
+        }
+        TelemetrySample sample = {(uint32_t)(i * 1000), i * 3, (float)i * 0.5f, (float)i * 0.25f};
+        size_t start = stream.size();
+        appendFrame(stream, sample, (uint8_t)i);
+        if (i == 700) {
+            stream[start + 9] ^= 0x10; // Corrupted on the line
+        }
+    }
+
+    TelemetryDecoder decoder;
+    int valid = 0;
+    bool inOrder = true;
+    uint32_t lastTimestamp = 0;
+    for (size_t i = 0; i < stream.size(); i++) {
+        if (decoder.push(stream[i])) {
+            const TelemetrySample& sample = decoder.sample();
+            inOrder = inOrder && (valid == 0 || sample.timestamp > lastTimestamp) &&
+                      sample.count == (int32_t)(sample.timestamp / 1000) * 3;
+            lastTimestamp = sample.timestamp;
+            valid++;
+        }
+    }
+
+    cout << "  Frames: " << decoder.frames() << ", rejected: " << decoder.errors() << ", lost: " << decoder.lost() << endl;
+    int failures = 0;
+    failures += check("Case 4.1: Every intact frame decoded, in order", valid == FRAMES - 2 && inOrder &&
+                      decoder.frames() == (uint32_t)(FRAMES - 2)) ? 0 : 1;
+    failures += check("Case 4.2: Partial first frame ignored, corrupted frame rejected", decoder.errors() == 1) ? 0 : 1;
+    failures += check("Case 4.3: Dropped and corrupted frames counted as lost", decoder.lost() == 2) ? 0 : 1;
+
+    if (capturePath != nullptr) {
+        ofstream capture(capturePath, ios::binary);
+        capture.write((const char*)stream.data(), (streamsize)stream.size());
+        cout << "  Stream written to " << capturePath << endl;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 5: Raw and filtered speed from the estimator
+// ============================================================================
+int testEstimatorSample() {
+    cout << "\n=== Test 5: Estimator sample ===" << endl;
+    SpeedEstimator speedEstimator(22.0f, 9.3f);
+    uint32_t timestamp = 0;
+    int pulses = 0;
+    float speed = 0;
+    for (int i = 0; i < 5; i++) {
+        timestamp += 10000;
+        pulses += 50;
+        speed = speedEstimator.estimateSpeed(pulses, timestamp);
+    }
+    float rawSpeed = 50.0f * 60.0e6f / (22.0f * 9.3f) / 10000.0f;
+    TelemetrySample sample = {timestamp, pulses, speedEstimator.filter().input(), speed};
+    cout << "  Raw: " << sample.rawSpeed << " RPM (expected " << rawSpeed << "), filtered: " << sample.speed << " RPM" << endl;
+
+    int failures = 0;
+    failures += check("Case 5.1: filter().input() is the unfiltered speed",
+                      fabs(sample.rawSpeed - rawSpeed) <= rawSpeed * 1e-5f && sample.speed < sample.rawSpeed) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Test 6: Buffer drops instead of blocking
+// ============================================================================
+
+/**
+ * @brief Output with a limited TX buffer, as HardwareSerial.
+ */
+struct MockSerial {
+    vector<uint8_t> bytes;
+    int room;
+
+    MockSerial() : room(0) {}
+    int availableForWrite() { return room; }
+    size_t write(const uint8_t* data, size_t length) {
+        bytes.insert(bytes.end(), data, data + length);
+        room -= (int)length;
+        return length;
+    }
+};
+
+int testBuffer() {
+    cout << "\n=== Test 6: Telemetry buffer ===" << endl;
+    int failures = 0;
+
+    TelemetryBuffer<8> buffer;
+    MockSerial serial;
+    TelemetryDecoder decoder;
+    int pushed = 0;
+    int decoded = 0;
+
+    // Case 6.1: 20 samples while the UART is busy: 8 queued, 12 dropped
+    for (int i = 0; i < 20; i++) {
+        pushed += buffer.push(TelemetrySample{(uint32_t)i, i, 0.0f, 0.0f}) ? 1 : 0;
+    }
+    size_t written = buffer.drain(serial);
+    failures += check("Case 6.1: Full buffer drops and counts, drain with no room writes nothing",
+                      pushed == 8 && buffer.dropped() == 12 && buffer.size() == 8 && written == 0) ? 0 : 1;
+
+    // Case 6.2: The UART frees 30 bytes at a time; frames are split across drains
+    for (int round = 0; round < 8; round++) {
+        serial.room = 30;
+        buffer.drain(serial);
+        for (size_t i = 0; i < serial.bytes.size(); i++) {
+            decoded += decoder.push(serial.bytes[i]) ? 1 : 0;
+        }
+        serial.bytes.clear();
+    }
+    failures += check("Case 6.2: Queued samples sent intact through partial writes",
+                      decoded == 8 && decoder.errors() == 0 && decoder.sample().timestamp == 7) ? 0 : 1;
+
+    // Case 6.3: Dropped samples appear as lost frames
+    buffer.push(TelemetrySample{100, 100, 0.0f, 0.0f}); // Sequence 20
+    serial.room = 100;
+    buffer.drain(serial);
+    for (size_t i = 0; i < serial.bytes.size(); i++) {
+        decoded += decoder.push(serial.bytes[i]) ? 1 : 0;
+    }
+    cout << "  Decoded: " << decoded << ", lost: " << decoder.lost() << ", dropped: " << buffer.dropped() << endl;
+    failures += check("Case 6.3: Sequence gap equals the dropped samples",
+                      decoded == 9 && decoder.lost() == buffer.dropped()) ? 0 : 1;
+
+    // Case 6.4: Byte-wise reading (TX-empty interrupt) produces the same stream as drain()
+    {
+        TelemetryBuffer<4> a, b;
+        MockSerial out;
+        out.room = 1000;
+        vector<uint8_t> bytes;
+        for (int i = 0; i < 3; i++) {
+            TelemetrySample sample = {(uint32_t)i * 7, -i, (float)i, (float)-i};
+            a.push(sample);
+            b.push(sample);
+        }
+        a.drain(out);
+        uint8_t byte;
+        while (b.nextByte(byte)) {
+            bytes.push_back(byte);
+        }
+        failures += check("Case 6.4: nextByte() and drain() send the same bytes",
+                          bytes == out.bytes && bytes.size() == 3 * TelemetryFrame::FRAME_SIZE) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 7: Concurrent writer and reader
+// ============================================================================
+int testConcurrentBuffer() {
+    cout << "\n=== Test 7: Concurrent writer and reader ===" << endl;
+    const uint32_t SAMPLES = 200000;
+    TelemetryBuffer<32> buffer;
+    atomic<bool> done(false);
+    uint32_t accepted = 0;
+
+    thread writer([&]() {
+        for (uint32_t i = 1; i <= SAMPLES; i++) {
+            accepted += buffer.push(TelemetrySample{i, (int32_t)i * 2, (float)i, (float)i * 0.5f}) ? 1 : 0;
+            if ((i & 63) == 0) {
+                this_thread::yield(); // Let the reader run on a single core
+            }
+        }
+        done = true;
+    });
+
+    TelemetryDecoder decoder;
+    uint32_t decoded = 0;
+    uint32_t missing = 0;
+    uint32_t last = 0;
+    bool consistent = true;
+    uint8_t byte;
+    for (;;) {
+        bool finished = done;
+        while (buffer.nextByte(byte)) {
+            if (decoder.push(byte)) {
+                const TelemetrySample& sample = decoder.sample();
+                consistent = consistent && sample.timestamp > last && sample.count == (int32_t)sample.timestamp * 2 &&
+                             sample.speed == (float)sample.timestamp * 0.5f;
+                missing += sample.timestamp - last - 1;
+                last = sample.timestamp;
+                decoded++;
+            }
+        }
+        if (finished) {
+            break;
+        }
+        this_thread::yield();
+    }
+    writer.join();
+    missing += SAMPLES - last;
+
+    cout << "  Decoded: " << decoded << ", dropped: " << buffer.dropped() << ", missing: " << missing << endl;
+    int failures = 0;
+    failures += check("Case 7.1: Samples arrive intact and in order", consistent && decoder.errors() == 0) ? 0 : 1;
+    failures += check("Case 7.2: Every sample is either received or counted as dropped",
+                      decoded == accepted && decoded + buffer.dropped() == SAMPLES && missing == buffer.dropped()) ? 0 : 1;
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main(int argc, char** argv) {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  Telemetry Test Suite                                      ║" << endl;
+    cout << "║  COBS framing, CRC, stream decoding and buffering          ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testFrameFormat();
+    failures += testRoundTrip();
+    failures += testCorruption();
+    failures += testStream(argc > 1 ? argv[1] : nullptr);
+    failures += testEstimatorSample();
+    failures += testBuffer();
+    failures += testConcurrentBuffer();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}
@@ -0,0 +1,419 @@
+// SPDX-FileCopyrightText: 2025 David Chirme Sisa ([dff-laoise](https://github.com/bulb-light))
+// SPDX-License-Identifier: MIT
+// For full license text, see the LICENSE file in the repository root or https://opensource.org/licenses/MIT
+
+/**
+ * @file tracking_estimator_tests.cpp
+ * @brief Test cases for the Kalman, alpha-beta(-gamma) and tracking observer estimators.
+ * Built by the CMake host build (see CMakeLists.txt), or by hand:
+ * g++ -std=c++11 -I.. -I../extras/host tracking_estimator_tests.cpp ../[A-Z]*.cpp ../extras/host/Arduino.cpp
+ */
+
+#include <iostream>
+#include <cmath>
+#include <climits>
+#include <vector>
+
+#include "TrackingEstimator.h"
+
+using namespace std;
+
+static const float PPR = 22.0f;
+static const float GEAR_RATIO = 9.3f;
+static const double COUNTS_PER_REV = 22.0 * 9.3;
+static const uint32_t PERIOD_US = 1000;
+static const float PROCESS_NOISE = 1.0e5f;
+
+static bool check(const char* name, double value, double expected, double tolerance) {
+    bool pass = fabs(value - expected) <= tolerance;
+    cout << name << endl;
+    cout << "  Value: " << value << endl;
+    cout << "  Expected: " << expected << " (± " << tolerance << ")" << endl;
+    cout << "  Result: " << (pass ? "PASS ✓" : "FAIL ✗") << "\n" << endl;
+    return pass;
+}
+
+/**
+ * @brief Encoder counts sampled every PERIOD_US for a speed profile.
+ * @param rpm Speed in RPM at time t in seconds.
+ * @param speeds True speed at each sample.
+ */
+static vector<int> makeTrace(double (*rpm)(double t), size_t n, vector<double>& speeds) {
+    vector<int> counts(n);
+    speeds.resize(n);
+    double position = 0.3;
+    double dt = PERIOD_US * 1e-6;
+    for (size_t i = 0; i < n; i++) {
+        double t = (double)i * dt;
+        speeds[i] = rpm(t);
+        counts[i] = (int)floor(position);
+        // Trapezoidal integration of the speed to counts
+        position += 0.5 * (rpm(t) + rpm(t + dt)) / 60.0 * COUNTS_PER_REV * dt;
+    }
+    return counts;
+}
+
+static double constantSpeed(double) { return 1000.0; }
+
+// 0.2 s at rest, then +2000 RPM/s
+static double rampSpeed(double t) { return (t < 0.2) ? 0.0 : (t - 0.2) * 2000.0; }
+
+/**
+ * @brief Mean error of the estimates against the true speed over [first, last).
+ */
+template <class Estimator>
+static double meanError(Estimator& estimator, const vector<int>& counts, const vector<double>& speeds, size_t first,
+                        size_t last, vector<float>* out = nullptr) {
+    double sum = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        float speed = estimator.estimateSpeed(counts[i]);
+        if (out != nullptr) {
+            out->push_back(speed);
+        }
+        if (i >= first && i < last) {
+            sum += speed - speeds[i];
+        }
+    }
+    return sum / (double)(last - first);
+}
+
+/**
+ * @brief Calls KalmanSpeedEstimator with the timestamps of the trace.
+ */
+struct KalmanAdapter {
+    KalmanSpeedEstimator& kalman;
+    uint32_t time;
+    float estimateSpeed(int pulsesCount) {
+        time += PERIOD_US;
+        return kalman.estimateSpeed(pulsesCount, time);
+    }
+};
+
+// ============================================================================
+// Test 1: Kalman filter
+// ============================================================================
+int testKalman() {
+    cout << "\n=== Test 1: KalmanSpeedEstimator ===" << endl;
+    int failures = 0;
+    vector<double> speeds;
+
+    // Case 1.1: Constant speed
+    {
+        vector<int> counts = makeTrace(constantSpeed, 2000, speeds);
+        KalmanSpeedEstimator kalman(PPR, GEAR_RATIO, PROCESS_NOISE);
+        KalmanAdapter adapter = {kalman, 0};
+        double error = meanError(adapter, counts, speeds, 1000, 2000);
+        failures += check("Case 1.1: Constant 1000 RPM, mean error over the last second", error, 0.0, 2.0) ? 0 : 1;
+    }
+
+    // Case 1.2: Ramp, constant-velocity model: steady-state lag
+    double lagVelocity;
+    {
+        vector<int> counts = makeTrace(rampSpeed, 1200, speeds);
+        KalmanSpeedEstimator kalman(PPR, GEAR_RATIO, PROCESS_NOISE);
+        KalmanAdapter adapter = {kalman, 0};
+        lagVelocity = meanError(adapter, counts, speeds, 800, 1200);
+        cout << "  Mean error on the ramp (constant velocity): " << lagVelocity << " RPM" << endl;
+    }
+
+    // Case 1.3: Ramp, constant-acceleration model: no steady-state lag
+    {
+        vector<int> counts = makeTrace(rampSpeed, 1200, speeds);
+        KalmanSpeedEstimator kalman(PPR, GEAR_RATIO, PROCESS_NOISE * 1.0e4f, KalmanSpeedEstimator::QUANTIZATION_NOISE,
+                                    true);
+        KalmanAdapter adapter = {kalman, 0};
+        double error = meanError(adapter, counts, speeds, 800, 1200);
+        cout << "  Mean error on the ramp (constant acceleration): " << error << " RPM" << endl;
+        failures += check("Case 1.2: Acceleration tracking removes the ramp lag", fabs(error) < fabs(lagVelocity) / 4 &&
+                          lagVelocity < 0, 1.0, 0.0) ? 0 : 1;
+        failures += check("Case 1.3: Estimated acceleration (RPM/s)", kalman.acceleration(), 2000.0, 200.0) ? 0 : 1;
+    }
+
+    // Case 1.4: Irregular intervals are used as measured
+    {
+        KalmanSpeedEstimator kalman(PPR, GEAR_RATIO, PROCESS_NOISE);
+        double position = 0;
+        uint32_t time = 0;
+        float speed = 0;
+        for (int i = 0; i < 3000; i++) {
+            uint32_t dt = (i % 3 == 0) ? 2500 : 500;
+            time += dt;
+            position += 500.0 / 60.0 * COUNTS_PER_REV * dt * 1e-6;
+            speed = kalman.estimateSpeed((int)floor(position), time);
+        }
+        failures += check("Case 1.4: 500 RPM with 0.5 ms and 2.5 ms intervals", speed, 500.0, 10.0) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 2: Steady-state gains
+// ============================================================================
+int testSteadyState() {
+    cout << "\n=== Test 2: Steady-state alpha-beta(-gamma) ===" << endl;
+    int failures = 0;
+    vector<double> speeds;
+
+    for (int acceleration = 0; acceleration < 2; acceleration++) {
+        float processNoise = acceleration ? PROCESS_NOISE * 1.0e4f : PROCESS_NOISE;
+        TrackingGains gains =
+            TrackingGains::steadyState(processNoise, KalmanSpeedEstimator::QUANTIZATION_NOISE, PERIOD_US, acceleration);
+        cout << "  alpha = " << gains.alpha << ", beta = " << gains.beta << ", gamma = " << gains.gamma << endl;
+
+        // Case 2.1: Alpha-beta relation of the continuous white acceleration model
+        // (beta = alpha^2 / (2 - alpha) when gamma = 0, approximately for small alpha)
+        if (!acceleration) {
+            failures += check("Case 2.1: alpha-beta gains are consistent", gains.beta,
+                              gains.alpha * gains.alpha / (2.0 - gains.alpha), 0.1 * gains.beta) ? 0 : 1;
+        } else {
+            failures += check("Case 2.1: alpha-beta-gamma gains are in range",
+                              gains.alpha > 0 && gains.alpha < 1 && gains.beta > 0 && gains.beta < 2 &&
+                              gains.gamma > 0 && gains.gamma < 1, 1.0, 0.0) ? 0 : 1;
+        }
+
+        // Case 2.2: Same output as the Kalman filter once converged
+        vector<int> counts = makeTrace(rampSpeed, 1500, speeds);
+        KalmanSpeedEstimator kalman(PPR, GEAR_RATIO, processNoise, KalmanSpeedEstimator::QUANTIZATION_NOISE,
+                                    acceleration);
+        KalmanAdapter adapter = {kalman, 0};
+        AlphaBetaEstimator alphaBeta(PPR, GEAR_RATIO, PERIOD_US, gains);
+        vector<float> kalmanOut, alphaBetaOut;
+        meanError(adapter, counts, speeds, 0, 1500, &kalmanOut);
+        meanError(alphaBeta, counts, speeds, 0, 1500, &alphaBetaOut);
+        double maxDifference = 0;
+        for (size_t i = 1000; i < counts.size(); i++) {
+            maxDifference = fmax(maxDifference, fabs(kalmanOut[i] - alphaBetaOut[i]));
+        }
+        failures += check(acceleration ? "Case 2.2: Alpha-beta-gamma matches the converged Kalman filter (RPM)"
+                                       : "Case 2.2: Alpha-beta matches the converged Kalman filter (RPM)",
+                          maxDifference, 0.0, 0.5) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 3: Fixed point
+// ============================================================================
+int testFixedPoint() {
+    cout << "\n=== Test 3: AlphaBetaEstimatorQ ===" << endl;
+    int failures = 0;
+    vector<double> speeds;
+
+    // Case 3.1: Same output as the float version, with and without acceleration
+    for (int acceleration = 0; acceleration < 2; acceleration++) {
+        TrackingGains gains = TrackingGains::steadyState(acceleration ? PROCESS_NOISE * 1.0e4f : PROCESS_NOISE,
+                                                         KalmanSpeedEstimator::QUANTIZATION_NOISE, PERIOD_US,
+                                                         acceleration);
+        vector<int> counts = makeTrace(rampSpeed, 1500, speeds);
+        AlphaBetaEstimator floatEstimator(PPR, GEAR_RATIO, PERIOD_US, gains);
+        AlphaBetaEstimatorQ fixedEstimator(PPR, GEAR_RATIO, PERIOD_US, gains);
+        double maxDifference = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            float reference = floatEstimator.estimateSpeed(counts[i]);
+            float fixed = fixedEstimator.estimateSpeed(counts[i]);
+            maxDifference = fmax(maxDifference, fabs(fixed - reference) - 0.001 * fabs(reference));
+        }
+        failures += check(acceleration ? "Case 3.1: Alpha-beta-gamma within 0.1 % + 0.05 RPM of float"
+                                       : "Case 3.1: Alpha-beta within 0.1 % + 0.05 RPM of float",
+                          maxDifference, 0.0, 0.05) ? 0 : 1;
+    }
+
+    // Case 3.2: Counter wrap-around
+    {
+        TrackingGains gains = TrackingGains::steadyState(PROCESS_NOISE, KalmanSpeedEstimator::QUANTIZATION_NOISE,
+                                                         PERIOD_US);
+        vector<int> counts = makeTrace(constantSpeed, 500, speeds);
+        AlphaBetaEstimatorQ plain(PPR, GEAR_RATIO, PERIOD_US, gains);
+        AlphaBetaEstimatorQ wrapped(PPR, GEAR_RATIO, PERIOD_US, gains);
+        bool same = true;
+        for (size_t i = 0; i < counts.size(); i++) {
+            int shifted = (int)((unsigned int)counts[i] + (unsigned int)INT_MAX - 700U);
+            same = same && plain.estimateSpeedQ(counts[i]) == wrapped.estimateSpeedQ(shifted);
+        }
+        failures += check("Case 3.2: Identical output across the counter wrap", same ? 1 : 0, 1, 0) ? 0 : 1;
+    }
+
+    // Case 3.3: A jump beyond the range saturates instead of wrapping
+    {
+        AlphaBetaEstimatorQ estimator(PPR, GEAR_RATIO, PERIOD_US, TrackingGains{0.5f, 0.2f, 0.0f});
+        estimator.estimateSpeedQ(0);
+        int32_t forward = estimator.estimateSpeedQ(200000);
+        estimator.reset();
+        estimator.estimateSpeedQ(0);
+        int32_t backward = estimator.estimateSpeedQ(-200000);
+        failures += check("Case 3.3: Large jumps keep their sign", forward > 0 && backward < 0, 1.0, 0.0) ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Test 4: Start and reset
+// ============================================================================
+int testReset() {
+    cout << "\n=== Test 4: Start and reset ===" << endl;
+    int failures = 0;
+
+    TrackingGains gains = {0.3f, 0.05f, 0.0f};
+    AlphaBetaEstimator alphaBeta(PPR, GEAR_RATIO, PERIOD_US, gains);
+    KalmanSpeedEstimator kalman(PPR, GEAR_RATIO, PROCESS_NOISE);
+
+    // Case 4.1: The first call only takes the count as the starting position
+    float first = alphaBeta.estimateSpeed(123456) + kalman.estimateSpeed(123456, 5000);
+    float second = alphaBeta.estimateSpeed(123456) + kalman.estimateSpeed(123456, 6000);
+    failures += check("Case 4.1: No speed from the initial count", fabs(first) + fabs(second), 0.0, 1e-6) ? 0 : 1;
+
+    // Case 4.2: reset() restarts from the next count
+    for (int i = 1; i <= 100; i++) {
+        alphaBeta.estimateSpeed(123456 + 3 * i);
+        kalman.estimateSpeed(123456 + 3 * i, 6000 + 1000 * i);
+    }
+    alphaBeta.reset();
+    kalman.reset();
+    first = alphaBeta.estimateSpeed(-5000) + kalman.estimateSpeed(-5000, 500000);
+    second = alphaBeta.estimateSpeed(-5000) + kalman.estimateSpeed(-5000, 501000);
+    failures += check("Case 4.2: reset() clears the state", fabs(first) + fabs(second), 0.0, 1e-6) ? 0 : 1;
+    return failures;
+}
+
+/**
+ * @brief Calls TrackingObserverEstimator with the timestamps of the trace.
+ */
+struct ObserverAdapter {
+    TrackingObserverEstimator& observer;
+    uint32_t time;
+    float estimateSpeed(int pulsesCount) {
+        time += PERIOD_US;
+        return observer.estimateSpeed(pulsesCount, time);
+    }
+};
+
+// ============================================================================
+// Test 5: Tracking observer
+// ============================================================================
+int testObserver() {
+    cout << "\n=== Test 5: TrackingObserverEstimator ===" << endl;
+    int failures = 0;
+    vector<double> speeds;
+    const float bandwidth = 10.0f;
+
+    // Case 5.1: Constant speed is tracked with no error
+    {
+        vector<int> counts = makeTrace(constantSpeed, 2000, speeds);
+        TrackingObserverEstimator observer(PPR, GEAR_RATIO, bandwidth);
+        ObserverAdapter adapter = {observer, 0};
+        double error = meanError(adapter, counts, speeds, 1000, 2000);
+        failures += check("Case 5.1: Constant 1000 RPM, mean error over the last second", error, 0.0, 2.0) ? 0 : 1;
+    }
+
+    // Case 5.2: During a ramp the speed lags by 2 / wn
+    {
+        vector<int> counts = makeTrace(rampSpeed, 1200, speeds);
+        TrackingObserverEstimator observer(PPR, GEAR_RATIO, bandwidth);
+        ObserverAdapter adapter = {observer, 0};
+        double lag = -meanError(adapter, counts, speeds, 800, 1200) / 2000.0;
+        failures += check("Case 5.2: Ramp lag in seconds", lag, 2.0 / (2.0 * M_PI * bandwidth), 0.002) ? 0 : 1;
+
+        observer.setBandwidth(2.0f * bandwidth);
+        observer.reset();
+        adapter.time = 0;
+        lag = -meanError(adapter, counts, speeds, 800, 1200) / 2000.0;
+        failures += check("Case 5.3: Twice the bandwidth, half the lag", lag, 1.0 / (2.0 * M_PI * bandwidth), 0.002)
+                    ? 0 : 1;
+    }
+
+    // Case 5.4: At a fixed period, an alpha-beta filter with the observer gains
+    {
+        vector<int> counts = makeTrace(rampSpeed, 1500, speeds);
+        TrackingObserverEstimator observer(PPR, GEAR_RATIO, bandwidth);
+        ObserverAdapter adapter = {observer, 0};
+        AlphaBetaEstimator alphaBeta(PPR, GEAR_RATIO, PERIOD_US, TrackingGains::observer(bandwidth, PERIOD_US));
+        double maxDifference = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            maxDifference = fmax(maxDifference, fabs(adapter.estimateSpeed(counts[i]) -
+                                                     alphaBeta.estimateSpeed(counts[i])));
+        }
+        failures += check("Case 5.4: Same output as AlphaBetaEstimator with TrackingGains::observer()",
+                          maxDifference, 0.0, 0.05) ? 0 : 1;
+    }
+
+    // Case 5.5: Fixed point, down to the 1 Hz bandwidth of observer_comparison, where the
+    // position error on the ramp (about 170 counts) is largest
+    const float bandwidths[] = {1.0f, bandwidth};
+    for (float hz : bandwidths) {
+        vector<int> counts = makeTrace(rampSpeed, 3000, speeds);
+        TrackingObserverEstimator observer(PPR, GEAR_RATIO, hz);
+        ObserverAdapter adapter = {observer, 0};
+        TrackingObserverEstimatorQ observerQ(PPR, GEAR_RATIO, PERIOD_US, hz);
+        double maxDifference = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            float reference = adapter.estimateSpeed(counts[i]);
+            float fixed = observerQ.estimateSpeed(counts[i]);
+            maxDifference = fmax(maxDifference, fabs(fixed - reference) - 0.001 * fabs(reference));
+        }
+        failures += check(hz < bandwidth ? "Case 5.5: Fixed point within 0.1 % + 0.05 RPM of float, 1 Hz bandwidth"
+                                         : "Case 5.5: Fixed point within 0.1 % + 0.05 RPM of float, 10 Hz bandwidth",
+                          maxDifference, 0.0, 0.05) ? 0 : 1;
+    }
+
+    // Case 5.6: Just above the stability limit (wn * T = 2 * sqrt(2) - 2, 131.8 Hz at 1 kHz),
+    // the bandwidth is limited and the loop settles on a constant speed
+    {
+        const float unstable = 140.0f;
+        const float limit = TrackingGains::maxObserverBandwidth(PERIOD_US);
+        TrackingGains requested = TrackingGains::observer(unstable, PERIOD_US);
+        TrackingGains limited = TrackingGains::observer(limit, PERIOD_US);
+        failures += check("Case 5.6a: Bandwidth limit at 1 kHz (Hz)", limit, 0.8 / (2.0 * M_PI * 1e-3), 0.01) ? 0 : 1;
+        failures += check("Case 5.6b: Stable gains (beta < 4 - 2 alpha)",
+                          requested.alpha == limited.alpha && requested.beta == limited.beta &&
+                          requested.beta < 4.0f - 2.0f * requested.alpha, 1, 0) ? 0 : 1;
+
+        vector<int> counts = makeTrace(constantSpeed, 2000, speeds);
+        TrackingObserverEstimator observer(PPR, GEAR_RATIO, unstable);
+        ObserverAdapter adapter = {observer, 0};
+        TrackingObserverEstimatorQ observerQ(PPR, GEAR_RATIO, PERIOD_US, unstable);
+        failures += check("Case 5.6c: TrackingObserverEstimatorQ reports the limited bandwidth (Hz)",
+                          observerQ.bandwidth(), limit, 1e-3) ? 0 : 1;
+        double maxError = 0, maxErrorQ = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            float speed = adapter.estimateSpeed(counts[i]);
+            float speedQ = observerQ.estimateSpeed(counts[i]);
+            // A diverging loop ends in NaN, which must not be dropped as fmax() would
+            double error = fabs(speed - speeds[i]), errorQ = fabs(speedQ - speeds[i]);
+            if (i >= 1000 && !(error <= maxError)) {
+                maxError = error;
+            }
+            if (i >= 1000 && !(errorQ <= maxErrorQ)) {
+                maxErrorQ = errorQ;
+            }
+        }
+        // One count per ms is 293 RPM: the wide loop lets the quantization through, but
+        // does not diverge
+        failures += check("Case 5.6d: Float observer at 140 Hz settles (max error, RPM)", maxError, 0.0, 300.0) ? 0 : 1;
+        failures += check("Case 5.6e: Fixed-point observer at 140 Hz settles (max error, RPM)", maxErrorQ, 0.0, 300.0)
+                    ? 0 : 1;
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main Test Runner
+// ============================================================================
+int main() {
+    cout << "╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  Tracking Estimator Test Suite                             ║" << endl;
+    cout << "║  Kalman, alpha-beta(-gamma) and tracking observer          ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝" << endl;
+
+    int failures = 0;
+    failures += testKalman();
+    failures += testSteadyState();
+    failures += testFixedPoint();
+    failures += testReset();
+    failures += testObserver();
+
+    cout << "\n╔════════════════════════════════════════════════════════════╗" << endl;
+    cout << "║  All tests completed!                                      ║" << endl;
+    cout << "╚════════════════════════════════════════════════════════════╝\n" << endl;
+
+    return failures;
+}